@@ -25,6 +25,8 @@
 
 #include "scheduler.hpp"
 
+#include <limits>
+
 namespace ns3 {
 
 /// @cond include_hidden
@@ -105,5 +107,236 @@ ScopedEventId::release()
   m_event.reset();
 }
 
+WheelTimer::WheelTimer()
+  : m_wheel(nullptr)
+  , m_prev(nullptr)
+  , m_next(nullptr)
+  , m_slot(0)
+  , m_expiry(0)
+{
+}
+
+WheelTimer::~WheelTimer()
+{
+  this->cancel();
+}
+
+void
+WheelTimer::cancel()
+{
+  if (m_wheel != nullptr) {
+    m_wheel->unlink(*this);
+  }
+}
+
+static const size_t ROOT_SIZE = 1 << TimerWheel::ROOT_BITS;
+static const size_t ROOT_MASK = ROOT_SIZE - 1;
+static const size_t LEVEL_SIZE = 1 << TimerWheel::LEVEL_BITS;
+static const size_t LEVEL_MASK = LEVEL_SIZE - 1;
+
+/** \brief the farthest expiration that can be placed, in ticks from current tick
+ */
+static const uint64_t MAX_DELTA =
+  (uint64_t(1) << (TimerWheel::ROOT_BITS + TimerWheel::N_LEVELS * TimerWheel::LEVEL_BITS)) - 1;
+
+static const uint64_t NO_EVENT = std::numeric_limits<uint64_t>::max();
+
+TimerWheel::TimerWheel(const ExpireCallback& onExpire, const time::nanoseconds& tick)
+  : m_onExpire(onExpire)
+  , m_tick(tick)
+  , m_slots(ROOT_SIZE + N_LEVELS * LEVEL_SIZE, nullptr)
+  , m_size(0)
+  , m_currentTick(0)
+  , m_eventTick(NO_EVENT)
+{
+  BOOST_ASSERT(m_tick > time::nanoseconds::zero());
+}
+
+TimerWheel::~TimerWheel()
+{
+  for (WheelTimer* head : m_slots) {
+    for (WheelTimer* timer = head; timer != nullptr; timer = timer->m_next) {
+      timer->m_wheel = nullptr;
+    }
+  }
+
+  if (m_eventTick != NO_EVENT) {
+    ns3::Simulator::Cancel(m_event);
+  }
+}
+
+uint64_t
+TimerWheel::getNowNs() const
+{
+  return static_cast<uint64_t>(ns3::Simulator::Now().GetNanoSeconds());
+}
+
+void
+TimerWheel::schedule(WheelTimer& timer, const time::nanoseconds& after)
+{
+  timer.cancel();
+
+  uint64_t now = this->getNowNs();
+  uint64_t tickNs = static_cast<uint64_t>(m_tick.count());
+  if (m_size == 0) {
+    // nothing to process until now
+    m_currentTick = std::max(m_currentTick, now / tickNs);
+  }
+
+  uint64_t expiry = now;
+  if (after > time::nanoseconds::zero()) {
+    expiry += static_cast<uint64_t>(after.count());
+  }
+  timer.m_expiry = (expiry + tickNs - 1) / tickNs;
+  timer.m_wheel = this;
+  ++m_size;
+  this->link(timer);
+
+  if (m_eventTick == NO_EVENT) {
+    this->scheduleEvent(this->findNextTick());
+  }
+  else if (timer.m_expiry < m_eventTick) {
+    // an expiration before the pending event is within the root wheel
+    this->scheduleEvent(std::max(timer.m_expiry, m_currentTick));
+  }
+}
+
+void
+TimerWheel::link(WheelTimer& timer)
+{
+  uint64_t expiry = std::max(timer.m_expiry, m_currentTick);
+  uint64_t delta = std::min(expiry - m_currentTick, MAX_DELTA);
+
+  if (delta < ROOT_SIZE) {
+    timer.m_slot = expiry & ROOT_MASK;
+  }
+  else {
+    // an expiration beyond the range is placed at the range limit, and placed again later
+    expiry = m_currentTick + delta;
+    size_t level = 0;
+    while (delta >> (ROOT_BITS + (level + 1) * LEVEL_BITS) != 0) {
+      ++level;
+    }
+    timer.m_slot = ROOT_SIZE + level * LEVEL_SIZE +
+                   ((expiry >> (ROOT_BITS + level * LEVEL_BITS)) & LEVEL_MASK);
+  }
+
+  WheelTimer*& head = m_slots[timer.m_slot];
+  timer.m_prev = nullptr;
+  timer.m_next = head;
+  if (head != nullptr) {
+    head->m_prev = &timer;
+  }
+  head = &timer;
+}
+
+void
+TimerWheel::unlink(WheelTimer& timer)
+{
+  BOOST_ASSERT(timer.m_wheel == this);
+
+  if (timer.m_prev != nullptr) {
+    timer.m_prev->m_next = timer.m_next;
+  }
+  else {
+    m_slots[timer.m_slot] = timer.m_next;
+  }
+  if (timer.m_next != nullptr) {
+    timer.m_next->m_prev = timer.m_prev;
+  }
+
+  timer.m_wheel = nullptr;
+  timer.m_prev = timer.m_next = nullptr;
+  --m_size;
+}
+
+void
+TimerWheel::cascade(size_t level, size_t index)
+{
+  WheelTimer*& head = m_slots[ROOT_SIZE + level * LEVEL_SIZE + index];
+  WheelTimer* timer = head;
+  head = nullptr;
+
+  while (timer != nullptr) {
+    WheelTimer* next = timer->m_next;
+    this->link(*timer);
+    timer = next;
+  }
+}
+
+void
+TimerWheel::processTick()
+{
+  size_t index = m_currentTick & ROOT_MASK;
+  if (index == 0) {
+    for (size_t level = 0; level < N_LEVELS; ++level) {
+      size_t levelIndex = (m_currentTick >> (ROOT_BITS + level * LEVEL_BITS)) & LEVEL_MASK;
+      this->cascade(level, levelIndex);
+      if (levelIndex != 0) {
+        break;
+      }
+    }
+  }
+
+  // the callback may cancel or schedule other timers, so that the slot is read every time
+  while (m_slots[index] != nullptr) {
+    WheelTimer& timer = *m_slots[index];
+    this->unlink(timer);
+    m_onExpire(timer);
+  }
+
+  ++m_currentTick;
+}
+
+uint64_t
+TimerWheel::findNextTick() const
+{
+  BOOST_ASSERT(m_size > 0);
+
+  uint64_t tick = m_currentTick;
+  if ((tick & ROOT_MASK) == 0) {
+    return tick; // cascade
+  }
+
+  for (; (tick & ROOT_MASK) != 0; ++tick) {
+    if (m_slots[tick & ROOT_MASK] != nullptr) {
+      return tick;
+    }
+  }
+  return tick; // next cascade
+}
+
+void
+TimerWheel::scheduleEvent(uint64_t tick)
+{
+  if (m_eventTick != NO_EVENT) {
+    if (m_eventTick <= tick) {
+      return;
+    }
+    ns3::Simulator::Cancel(m_event);
+  }
+
+  uint64_t at = tick * static_cast<uint64_t>(m_tick.count());
+  uint64_t now = this->getNowNs();
+  m_event = ns3::Simulator::Schedule(ns3::NanoSeconds(at > now ? at - now : 0),
+                                     &TimerWheel::onEvent, this);
+  m_eventTick = tick;
+}
+
+void
+TimerWheel::onEvent()
+{
+  m_eventTick = NO_EVENT;
+
+  uint64_t nowTick = this->getNowNs() / static_cast<uint64_t>(m_tick.count());
+  while (m_size > 0 && m_currentTick <= nowTick) {
+    this->processTick();
+  }
+
+  if (m_size > 0) {
+    this->scheduleEvent(this->findNextTick());
+  }
+}
+
 } // namespace scheduler
 } // namespace nfd
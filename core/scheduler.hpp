@@ -91,6 +91,137 @@ private:
   EventId m_event;
 };
 
+class TimerWheel;
+
+/** \brief a timer scheduled on a TimerWheel
+ *
+ *  A WheelTimer is intrusive: it is embedded in the object it belongs to, and links itself
+ *  into a slot of the TimerWheel. Scheduling and cancelling it allocate no memory.
+ *  A timer that is destructed while scheduled is cancelled.
+ */
+class WheelTimer : noncopyable
+{
+public:
+  WheelTimer();
+
+  ~WheelTimer();
+
+  bool
+  isScheduled() const
+  {
+    return m_wheel != nullptr;
+  }
+
+  /** \brief cancels the timer if it is scheduled
+   */
+  void
+  cancel();
+
+private:
+  TimerWheel* m_wheel;
+  WheelTimer* m_prev;
+  WheelTimer* m_next;
+  size_t m_slot;
+  uint64_t m_expiry;
+
+  friend class TimerWheel;
+};
+
+/** \brief a hierarchical timer wheel
+ *
+ *  Time is divided into ticks. A timer expiring within 256 ticks is kept in a slot of the
+ *  root wheel; a later timer is kept in one of four coarser wheels of 64 slots, and is moved
+ *  towards the root wheel as time advances, as in the Linux kernel timer wheel.
+ *
+ *  All timers expiring in the same tick are processed by a single ns-3 event,
+ *  and ticks without any expiring timer are skipped.
+ *  A timer expires at the end of the tick containing its expiration time,
+ *  so it is never early and at most one tick late.
+ */
+class TimerWheel : noncopyable
+{
+public:
+  /** \brief callback invoked when a timer expires
+   *
+   *  The timer is no longer scheduled when the callback is invoked,
+   *  and may be scheduled again by the callback.
+   */
+  typedef function<void(WheelTimer& timer)> ExpireCallback;
+
+  explicit
+  TimerWheel(const ExpireCallback& onExpire,
+             const time::nanoseconds& tick = time::milliseconds(1));
+
+  /** \brief cancels all timers
+   */
+  ~TimerWheel();
+
+  /** \brief schedules timer to expire after a duration
+   *
+   *  If timer is already scheduled, it is rescheduled.
+   */
+  void
+  schedule(WheelTimer& timer, const time::nanoseconds& after);
+
+  /** \return number of scheduled timers
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  const time::nanoseconds&
+  getTick() const
+  {
+    return m_tick;
+  }
+
+private:
+  uint64_t
+  getNowNs() const;
+
+  void
+  link(WheelTimer& timer);
+
+  void
+  unlink(WheelTimer& timer);
+
+  void
+  cascade(size_t level, size_t index);
+
+  void
+  processTick();
+
+  /** \return the earliest tick that may have expiring timers or need a cascade
+   */
+  uint64_t
+  findNextTick() const;
+
+  void
+  scheduleEvent(uint64_t tick);
+
+  void
+  onEvent();
+
+public:
+  static const size_t ROOT_BITS = 8;
+  static const size_t LEVEL_BITS = 6;
+  static const size_t N_LEVELS = 4;
+
+private:
+  ExpireCallback m_onExpire;
+  time::nanoseconds m_tick;
+  std::vector<WheelTimer*> m_slots;
+  size_t m_size;
+  uint64_t m_currentTick; ///< next tick to be processed
+
+  ns3::EventId m_event;
+  uint64_t m_eventTick; ///< tick of m_event, or NO_EVENT
+
+  friend class WheelTimer;
+};
+
 } // namespace scheduler
 
 } // namespace nfd
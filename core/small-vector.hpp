@@ -0,0 +1,363 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_SMALL_VECTOR_HPP
+#define NFD_CORE_SMALL_VECTOR_HPP
+
+#include "common.hpp"
+
+#include <memory>
+#include <type_traits>
+
+namespace nfd {
+
+/** \brief a sequence container that stores up to N elements without heap allocation
+ *  \tparam T element type, which must be MoveConstructible and MoveAssignable
+ *  \tparam N number of elements stored inline
+ *
+ *  Elements are contiguous: they live in an inline buffer while size() <= N,
+ *  and are moved to a heap buffer when the container grows beyond that.
+ *  A heap buffer is kept by clear() and erase().
+ *
+ *  Iterators are pointers. Like std::vector, emplace_back() and erase() invalidate them.
+ */
+template<typename T, size_t N>
+class SmallVector
+{
+  static_assert(N > 0, "SmallVector must have inline capacity");
+
+public:
+  typedef T value_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef T* iterator;
+  typedef const T* const_iterator;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  SmallVector()
+    : m_begin(this->getInlineBuffer())
+    , m_size(0)
+    , m_capacity(N)
+  {
+  }
+
+  SmallVector(const SmallVector& other)
+    : SmallVector()
+  {
+    this->reserve(other.size());
+    std::uninitialized_copy(other.begin(), other.end(), m_begin);
+    m_size = other.size();
+  }
+
+  /** \brief takes the heap buffer of other, or moves its inline elements
+   *  \post other is empty
+   */
+  SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    : SmallVector()
+  {
+    this->takeFrom(other);
+  }
+
+  SmallVector&
+  operator=(const SmallVector& other)
+  {
+    if (this != &other) {
+      this->clear();
+      this->reserve(other.size());
+      std::uninitialized_copy(other.begin(), other.end(), m_begin);
+      m_size = other.size();
+    }
+    return *this;
+  }
+
+  /** \post other is empty
+   */
+  SmallVector&
+  operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+  {
+    if (this != &other) {
+      this->clear();
+      if (!this->isInline()) {
+        ::operator delete(m_begin);
+        m_begin = this->getInlineBuffer();
+        m_capacity = N;
+      }
+      this->takeFrom(other);
+    }
+    return *this;
+  }
+
+  ~SmallVector()
+  {
+    this->clear();
+    if (!this->isInline()) {
+      ::operator delete(m_begin);
+    }
+  }
+
+public: // iteration
+  iterator
+  begin()
+  {
+    return m_begin;
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_begin;
+  }
+
+  iterator
+  end()
+  {
+    return m_begin + m_size;
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_begin + m_size;
+  }
+
+  reference
+  front()
+  {
+    BOOST_ASSERT(!this->empty());
+    return *m_begin;
+  }
+
+  const_reference
+  front() const
+  {
+    BOOST_ASSERT(!this->empty());
+    return *m_begin;
+  }
+
+  reference
+  back()
+  {
+    BOOST_ASSERT(!this->empty());
+    return m_begin[m_size - 1];
+  }
+
+  const_reference
+  back() const
+  {
+    BOOST_ASSERT(!this->empty());
+    return m_begin[m_size - 1];
+  }
+
+  reference
+  operator[](size_t i)
+  {
+    BOOST_ASSERT(i < m_size);
+    return m_begin[i];
+  }
+
+  const_reference
+  operator[](size_t i) const
+  {
+    BOOST_ASSERT(i < m_size);
+    return m_begin[i];
+  }
+
+public: // size
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  capacity() const
+  {
+    return m_capacity;
+  }
+
+  /** \return whether elements are stored in the inline buffer
+   */
+  bool
+  isInline() const
+  {
+    return m_begin == this->getInlineBuffer();
+  }
+
+  /** \brief ensures capacity() >= n
+   */
+  void
+  reserve(size_t n)
+  {
+    if (n <= m_capacity) {
+      return;
+    }
+
+    T* buffer = static_cast<T*>(::operator new(n * sizeof(T)));
+    this->moveTo(buffer);
+    m_capacity = n;
+  }
+
+public: // modifiers
+  /** \brief constructs an element at the end
+   *  \return reference to the new element
+   */
+  template<typename... Args>
+  reference
+  emplace_back(Args&&... args)
+  {
+    if (m_size < m_capacity) {
+      ::new(static_cast<void*>(m_begin + m_size)) T(std::forward<Args>(args)...);
+    }
+    else {
+      // construct the new element before moving, in case args refer to an existing element
+      size_t newCapacity = m_capacity * 2;
+      T* buffer = static_cast<T*>(::operator new(newCapacity * sizeof(T)));
+      try {
+        ::new(static_cast<void*>(buffer + m_size)) T(std::forward<Args>(args)...);
+      }
+      catch (...) {
+        ::operator delete(buffer);
+        throw;
+      }
+      this->moveTo(buffer);
+      m_capacity = newCapacity;
+    }
+
+    ++m_size;
+    return this->back();
+  }
+
+  void
+  push_back(const T& value)
+  {
+    this->emplace_back(value);
+  }
+
+  void
+  push_back(T&& value)
+  {
+    this->emplace_back(std::move(value));
+  }
+
+  /** \brief erases an element, shifting the following elements forward
+   *  \return iterator to the element that followed the erased one
+   */
+  iterator
+  erase(const_iterator pos)
+  {
+    BOOST_ASSERT(pos >= this->begin() && pos < this->end());
+    iterator it = m_begin + (pos - m_begin);
+    std::move(it + 1, this->end(), it);
+    this->pop_back();
+    return it;
+  }
+
+  void
+  pop_back()
+  {
+    BOOST_ASSERT(!this->empty());
+    --m_size;
+    m_begin[m_size].~T();
+  }
+
+  void
+  clear()
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      m_begin[i].~T();
+    }
+    m_size = 0;
+  }
+
+private:
+  T*
+  getInlineBuffer()
+  {
+    return reinterpret_cast<T*>(m_inline);
+  }
+
+  const T*
+  getInlineBuffer() const
+  {
+    return reinterpret_cast<const T*>(m_inline);
+  }
+
+  /** \brief moves the elements of other into this empty inline container
+   */
+  void
+  takeFrom(SmallVector& other)
+  {
+    BOOST_ASSERT(this->empty() && this->isInline());
+
+    if (other.isInline()) {
+      for (size_t i = 0; i < other.m_size; ++i) {
+        ::new(static_cast<void*>(m_begin + i)) T(std::move(other.m_begin[i]));
+      }
+      m_size = other.m_size;
+      other.clear();
+      return;
+    }
+
+    m_begin = other.m_begin;
+    m_size = other.m_size;
+    m_capacity = other.m_capacity;
+    other.m_begin = other.getInlineBuffer();
+    other.m_size = 0;
+    other.m_capacity = N;
+  }
+
+  /** \brief moves existing elements into buffer and adopts buffer as storage
+   */
+  void
+  moveTo(T* buffer)
+  {
+    for (size_t i = 0; i < m_size; ++i) {
+      ::new(static_cast<void*>(buffer + i)) T(std::move(m_begin[i]));
+      m_begin[i].~T();
+    }
+
+    if (!this->isInline()) {
+      ::operator delete(m_begin);
+    }
+    m_begin = buffer;
+  }
+
+private:
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+  T* m_begin;
+  size_t m_size;
+  size_t m_capacity;
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_SMALL_VECTOR_HPP
@@ -57,6 +57,13 @@ public:
   }
   // postfix ++ operator is not provided because it's not needed
 
+  PacketCounter&
+  operator+=(rep n)
+  {
+    m_value += n;
+    return *this;
+  }
+
   void
   set(rep value)
   {
@@ -244,6 +251,36 @@ public:
     this->NetworkLayerCounters::copyTo(recipient);
     this->LinkLayerCounters::copyTo(recipient);
   }
+
+  /// subscribed Data held back by subscription shaping
+  const PacketCounter&
+  getNShapedDatasDelayed() const
+  {
+    return m_nShapedDatasDelayed;
+  }
+
+  PacketCounter&
+  getNShapedDatasDelayed()
+  {
+    return m_nShapedDatasDelayed;
+  }
+
+  /// subscribed Data dropped by subscription shaping, or superseded while held back
+  const PacketCounter&
+  getNShapedDatasDropped() const
+  {
+    return m_nShapedDatasDropped;
+  }
+
+  PacketCounter&
+  getNShapedDatasDropped()
+  {
+    return m_nShapedDatasDropped;
+  }
+
+private:
+  PacketCounter m_nShapedDatasDelayed;
+  PacketCounter m_nShapedDatasDropped;
 };
 
 } // namespace nfd
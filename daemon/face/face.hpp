@@ -34,6 +34,10 @@
 
 namespace nfd {
 
+namespace fw {
+class SubscriptionShaper;
+} // namespace fw
+
 /** \class FaceId
  *  \brief identifies a face
  */
@@ -215,6 +219,8 @@ private:
 
   // allow setting FaceId
   friend class FaceTable;
+  // allow counting shaped Data
+  friend class fw::SubscriptionShaper;
 };
 
 inline FaceId
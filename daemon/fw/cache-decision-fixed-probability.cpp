@@ -0,0 +1,47 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cache-decision-fixed-probability.hpp"
+
+namespace nfd {
+namespace fw {
+
+const double CacheDecisionFixedProbability::DEFAULT_PROBABILITY = 0.5;
+
+CacheDecisionFixedProbability::CacheDecisionFixedProbability(double probability)
+  : m_probability(probability)
+{
+  BOOST_ASSERT(probability >= 0.0 && probability <= 1.0);
+}
+
+bool
+CacheDecisionFixedProbability::decide(const Face& inFace, const Data& data,
+                                      const pit::CombinedDataMatchResult& matches) const
+{
+  return drawBernoulli(m_probability);
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,51 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_CACHE_DECISION_LCD_HPP
+#define NFD_DAEMON_FW_CACHE_DECISION_LCD_HPP
+
+#include "cache-decision.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief Leave Copy Down cache decision
+ *
+ *  Data is cached only at the node one link below where it was produced or served from a cache,
+ *  so that each request moves a copy of popular content one level closer to consumers.
+ *  Data from a local application is not cached, because this node is its origin.
+ */
+class CacheDecisionLcd : public CacheDecision
+{
+public:
+  virtual bool
+  decide(const Face& inFace, const Data& data,
+         const pit::CombinedDataMatchResult& matches) const DECL_OVERRIDE;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_CACHE_DECISION_LCD_HPP
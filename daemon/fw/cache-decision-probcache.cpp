@@ -0,0 +1,61 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cache-decision-probcache.hpp"
+
+namespace nfd {
+namespace fw {
+
+const double CacheDecisionProbCache::DEFAULT_TIMES_IN = 1.0;
+
+CacheDecisionProbCache::CacheDecisionProbCache(double timesIn)
+  : m_timesIn(timesIn)
+{
+  BOOST_ASSERT(timesIn > 0.0);
+}
+
+double
+CacheDecisionProbCache::computeProbability(size_t nDataHops, size_t nInterestHops) const
+{
+  size_t pathLength = nDataHops + nInterestHops;
+  if (pathLength == 0) {
+    return 0.0;
+  }
+  return std::min(1.0, m_timesIn * nDataHops / pathLength);
+}
+
+bool
+CacheDecisionProbCache::decide(const Face& inFace, const Data& data,
+                               const pit::CombinedDataMatchResult& matches) const
+{
+  if (inFace.isLocal()) {
+    return false;
+  }
+  return drawBernoulli(this->computeProbability(getDataHopCount(data),
+                                                getInterestHopCount(matches)));
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_CACHE_DECISION_PROBCACHE_HPP
+#define NFD_DAEMON_FW_CACHE_DECISION_PROBCACHE_HPP
+
+#include "cache-decision.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief ProbCache-style cache decision
+ *
+ *  Data is cached with probability min(1, timesIn * x / c), where x is the number of links
+ *  Data has travelled from its origin, and c is x plus the number of links the satisfied
+ *  Interest has travelled from its consumer.
+ *  Nodes closer to consumers therefore cache with higher probability,
+ *  and caching is spread along the path instead of being replicated at every node.
+ *  \p timesIn scales the probability to account for cache capacity along the path.
+ *
+ *  \sa Psaras, Chai and Pavlou, "Probabilistic In-Network Caching for Information-Centric
+ *      Networks", ICN workshop 2012
+ */
+class CacheDecisionProbCache : public CacheDecision
+{
+public:
+  explicit
+  CacheDecisionProbCache(double timesIn = DEFAULT_TIMES_IN);
+
+  /** \return caching probability for given path position
+   */
+  double
+  computeProbability(size_t nDataHops, size_t nInterestHops) const;
+
+  virtual bool
+  decide(const Face& inFace, const Data& data,
+         const pit::CombinedDataMatchResult& matches) const DECL_OVERRIDE;
+
+public:
+  static const double DEFAULT_TIMES_IN;
+
+private:
+  const double m_timesIn;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_CACHE_DECISION_PROBCACHE_HPP
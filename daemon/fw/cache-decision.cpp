@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cache-decision.hpp"
+#include "core/random.hpp"
+#include "utils/ndn-ns3-packet-tag.hpp"
+#include "utils/ndn-fw-hop-count-tag.hpp"
+
+#include <boost/random/bernoulli_distribution.hpp>
+#include <limits>
+
+namespace nfd {
+namespace fw {
+
+CacheDecision::~CacheDecision()
+{
+}
+
+template<typename P>
+static size_t
+getHopCount(const P& packet)
+{
+  shared_ptr<ns3::ndn::Ns3PacketTag> tag = packet.template getTag<ns3::ndn::Ns3PacketTag>();
+  if (tag == nullptr) {
+    return 0;
+  }
+
+  ns3::ndn::FwHopCountTag hopCountTag;
+  if (!tag->getPacket()->PeekPacketTag(hopCountTag)) {
+    return 0;
+  }
+  return hopCountTag.Get();
+}
+
+size_t
+CacheDecision::getDataHopCount(const Data& data)
+{
+  return getHopCount(data);
+}
+
+size_t
+CacheDecision::getInterestHopCount(const pit::CombinedDataMatchResult& matches)
+{
+  size_t nHops = std::numeric_limits<size_t>::max();
+  for (const shared_ptr<pit::Entry>& pitEntry : matches.pitMatches) {
+    nHops = std::min(nHops, getHopCount(pitEntry->getInterest()));
+  }
+  for (const shared_ptr<pit::SitEntry>& sitEntry : matches.sitMatches) {
+    nHops = std::min(nHops, getHopCount(sitEntry->getInterest()));
+  }
+  return nHops == std::numeric_limits<size_t>::max() ? 0 : nHops;
+}
+
+bool
+CacheDecision::drawBernoulli(double probability)
+{
+  if (probability >= 1.0) {
+    return true;
+  }
+  if (probability <= 0.0) {
+    return false;
+  }
+  boost::random::bernoulli_distribution<double> dist(probability);
+  return dist(getGlobalRng());
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_CACHE_DECISION_HPP
+#define NFD_DAEMON_FW_CACHE_DECISION_HPP
+
+#include "face/face.hpp"
+#include "table/sit.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief decides whether an incoming Data that satisfies pending Interests
+ *         is admitted into the ContentStore
+ *
+ *  Forwarder consults the decision between PIT match and CS insert.
+ *  When the decision is negative, the Data is neither copied nor inserted.
+ */
+class CacheDecision : noncopyable
+{
+public:
+  virtual
+  ~CacheDecision();
+
+  /** \brief determines whether Data shall be cached
+   *  \param inFace face on which Data arrived
+   *  \param data the incoming Data
+   *  \param matches PIT and SIT entries satisfied by Data
+   */
+  virtual bool
+  decide(const Face& inFace, const Data& data,
+         const pit::CombinedDataMatchResult& matches) const = 0;
+
+protected:
+  /** \return number of links Data has travelled since it was produced or served from a cache
+   *
+   *  The count is taken from the hop count tag that ndnSIM attaches to simulated packets.
+   *  Zero is returned if the tag is absent, eg. Data came from a local application.
+   */
+  static size_t
+  getDataHopCount(const Data& data);
+
+  /** \return smallest number of links a satisfied Interest has travelled from its consumer,
+   *          or zero if unknown
+   */
+  static size_t
+  getInterestHopCount(const pit::CombinedDataMatchResult& matches);
+
+  /** \return true with probability \p probability
+   */
+  static bool
+  drawBernoulli(double probability);
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_CACHE_DECISION_HPP
@@ -35,6 +35,84 @@ namespace nfd {
 class ForwarderCounters : public NetworkLayerCounters
 {
 public:
+  /// NameTree entries visited by PIT+SIT Data match
+  const PacketCounter&
+  getNDataMatchNameTreeEntries() const
+  {
+    return m_nDataMatchNameTreeEntries;
+  }
+
+  PacketCounter&
+  getNDataMatchNameTreeEntries()
+  {
+    return m_nDataMatchNameTreeEntries;
+  }
+
+  /// PIT entries tested by PIT+SIT Data match
+  const PacketCounter&
+  getNDataMatchPitEntries() const
+  {
+    return m_nDataMatchPitEntries;
+  }
+
+  PacketCounter&
+  getNDataMatchPitEntries()
+  {
+    return m_nDataMatchPitEntries;
+  }
+
+  /// SIT entries tested by PIT+SIT Data match
+  const PacketCounter&
+  getNDataMatchSitEntries() const
+  {
+    return m_nDataMatchSitEntries;
+  }
+
+  PacketCounter&
+  getNDataMatchSitEntries()
+  {
+    return m_nDataMatchSitEntries;
+  }
+
+  /// satisfying Data not inserted into CS due to cache decision
+  const PacketCounter&
+  getNCsDeclined() const
+  {
+    return m_nCsDeclined;
+  }
+
+  PacketCounter&
+  getNCsDeclined()
+  {
+    return m_nCsDeclined;
+  }
+
+  /// hard subscription refreshes sent to upstream faces
+  const PacketCounter&
+  getNSubscriptionRefreshesForwarded() const
+  {
+    return m_nSubscriptionRefreshesForwarded;
+  }
+
+  PacketCounter&
+  getNSubscriptionRefreshesForwarded()
+  {
+    return m_nSubscriptionRefreshesForwarded;
+  }
+
+  /// hard subscription refreshes not forwarded due to aggregation
+  const PacketCounter&
+  getNSubscriptionRefreshesSuppressed() const
+  {
+    return m_nSubscriptionRefreshesSuppressed;
+  }
+
+  PacketCounter&
+  getNSubscriptionRefreshesSuppressed()
+  {
+    return m_nSubscriptionRefreshesSuppressed;
+  }
+
   /** \brief copy current obseverations to a struct
    *  \param recipient an object with set methods for counters
    */
@@ -44,6 +122,14 @@ public:
   {
     this->NetworkLayerCounters::copyTo(recipient);
   }
+
+private:
+  PacketCounter m_nDataMatchNameTreeEntries;
+  PacketCounter m_nDataMatchPitEntries;
+  PacketCounter m_nDataMatchSitEntries;
+  PacketCounter m_nCsDeclined;
+  PacketCounter m_nSubscriptionRefreshesForwarded;
+  PacketCounter m_nSubscriptionRefreshesSuppressed;
 };
 
 } // namespace nfd
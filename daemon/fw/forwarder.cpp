@@ -40,22 +40,32 @@ NFD_LOG_INIT("Forwarder");
 using fw::Strategy;
 
 const Name Forwarder::LOCALHOST_NAME("ndn:/localhost");
+const time::milliseconds Forwarder::DEFAULT_SUBSCRIPTION_REFRESH_INTERVAL = time::seconds(1);
+const time::milliseconds Forwarder::SIT_SWEEP_INTERVAL = time::milliseconds(250);
+const size_t Forwarder::SIT_SWEEP_MIN_ENTRIES = 64;
+const size_t Forwarder::SIT_SWEEP_FRACTION = 4;
 
 Forwarder::Forwarder()
   : m_faceTable(*this)
+  , m_pitTimers(bind(&Forwarder::onPitTimerExpired, this, _1))
   , m_fib(m_nameTree)
-  , m_pit(m_nameTree)
-  , m_sit(m_nameTree)
+  , m_pit(m_nameTree, &m_pitEntryPool)
+  , m_sit(m_nameTree, &m_pitEntryPool)
   , m_measurements(m_nameTree)
   , m_strategyChoice(m_nameTree, fw::makeDefaultStrategy(*this))
   , m_csFace(make_shared<NullFace>(FaceUri("contentstore://")))
+  , m_subscriptionRefreshInterval(DEFAULT_SUBSCRIPTION_REFRESH_INTERVAL)
+  , m_subscriptionShaper(bind(&Forwarder::onOutgoingData, this, _1, _2))
 {
   fw::installStrategies(*this);
   getFaceTable().addReserved(m_csFace, FACEID_CONTENT_STORE);
+
+  m_sitSweepEvent = scheduler::schedule(SIT_SWEEP_INTERVAL, bind(&Forwarder::onSitSweep, this));
 }
 
 Forwarder::~Forwarder()
 {
+  scheduler::cancel(m_sitSweepEvent);
 
 }
 
@@ -86,7 +96,9 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
         // detect duplicate Nonce
         int dnw = pitEntry->findNonce(interest.getNonce(), inFace);
         bool hasDuplicateNonce = (dnw != pit::DUPLICATE_NONCE_NONE) ||
-                                  m_deadNonceList.has(interest.getName(), interest.getNonce());
+                                  m_deadNonceList.has(m_nameTree.get(*pitEntry)->getHash(),
+                                                      interest.getName().size(),
+                                                      interest.getNonce());
         if (hasDuplicateNonce) {
                 // goto Interest loop pipeline
                 this->onInterestLoop(inFace, interest, pitEntry);
@@ -133,15 +145,16 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
         // detect duplicate Nonce
         int dnw = pitEntry->findNonce(interest.getNonce(), inFace);
         bool hasDuplicateNonce = (dnw != pit::DUPLICATE_NONCE_NONE) ||
-                                  m_deadNonceList.has(interest.getName(), interest.getNonce());
+                                  m_deadNonceList.has(m_nameTree.get(*pitEntry)->getHash(),
+                                                      interest.getName().size(),
+                                                      interest.getNonce());
         if (hasDuplicateNonce) {
                 // goto Interest loop pipeline
                 this->onInterestLoop(inFace, interest, pitEntry);
                 return;
         }
 
-        // cancel unsatisfy & straggler timer
-        this->cancelUnsatisfyAndStragglerTimer(pitEntry);
+        // SIT entries have no unsatisfy timer, they expire by lease (see onSitSweep)
 
         // is pending?
         const pit::InRecordCollection& inRecords = pitEntry->getInRecords();
@@ -171,7 +184,7 @@ Forwarder::onIncomingInterest(Face& inFace, const Interest& interest)
 
 void
 Forwarder::onContentStoreMiss(const Face& inFace,
-                              shared_ptr<pit::Entry> pitEntry,
+                              const shared_ptr<pit::Entry>& pitEntry,
                               const Interest& interest)
 {
   NFD_LOG_DEBUG("onContentStoreMiss interest=" << interest.getName());
@@ -187,21 +200,23 @@ Forwarder::onContentStoreMiss(const Face& inFace,
   shared_ptr<fib::Entry> fibEntry = m_fib.findLongestPrefixMatch(*pitEntry);
 
   // dispatch to strategy
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveInterest, _1,
-                                          cref(inFace), cref(interest), fibEntry, pitEntry));
+  this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+    strategy.afterReceiveInterest(inFace, interest, fibEntry, pitEntry);
+  });
 }
 
 void
 Forwarder::onContentStoreHit(const Face& inFace,
-                             shared_ptr<pit::Entry> pitEntry,
+                             const shared_ptr<pit::Entry>& pitEntry,
                              const Interest& interest,
                              const Data& data)
 {
   NFD_LOG_DEBUG("onContentStoreHit interest=" << interest.getName());
 
   beforeSatisfyInterest(*pitEntry, *m_csFace, data);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeSatisfyInterest, _1,
-                                          pitEntry, cref(*m_csFace), cref(data)));
+  this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+    strategy.beforeSatisfyInterest(pitEntry, *m_csFace, data);
+  });
 
   const_pointer_cast<Data>(data.shared_from_this())->setIncomingFaceId(FACEID_CONTENT_STORE);
   // XXX should we lookup PIT for other Interests that also match csMatch?
@@ -215,7 +230,7 @@ Forwarder::onContentStoreHit(const Face& inFace,
 
 void
 Forwarder::onSitContentStoreMiss(const Face& inFace,
-                              shared_ptr<pit::Entry> pitEntry,
+                              const shared_ptr<pit::Entry>& pitEntry,
                               const Interest& interest,
 			      bool isNewEntry)
 {
@@ -225,13 +240,6 @@ Forwarder::onSitContentStoreMiss(const Face& inFace,
   // insert InRecord
   pitEntry->insertOrUpdateInRecord(face, interest);
 
-  // set SIT unsatisfy timer
-  this->setUnsatisfyTimer(pitEntry);
-
-  // only forward up if it hasnt been forwarded recently
-  //-----#define SUBSCRIPTION_HARD_LIMIT boost::chrono::minutes(15)
-  //-----if(pitEntry->getLastForwarded() < time::steady_clock::now() - SUBSCRIPTION_HARD_LIMIT){
-
   if (interest.getSubscription() == 1) {
 
  	// Soft subscription
@@ -242,54 +250,62 @@ Forwarder::onSitContentStoreMiss(const Face& inFace,
         	shared_ptr<fib::Entry> fibEntry = m_fib.findLongestPrefixMatch(*pitEntry);
 
         	// dispatch to strategy
-        	this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveInterest, _1,
-                                                cref(inFace), cref(interest), fibEntry, pitEntry));
+        	this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+        	  strategy.afterReceiveInterest(inFace, interest, fibEntry, pitEntry);
+        	});
 	}
 
   }
   else {
 	// Hard subscription
+        shared_ptr<pit::SitEntry> sitEntry = static_pointer_cast<pit::SitEntry>(pitEntry);
+        sitEntry->insertOrUpdateInRecord(face, interest);
+
+        // coalesce refreshes from all downstreams into one upstream refresh per interval
+        bool isRecentlyForwarded = sitEntry->getLastForwarded() >
+                                   time::steady_clock::now() - m_subscriptionRefreshInterval;
+        if (!isNewEntry && isRecentlyForwarded && sitEntry->hasUnexpiredOutRecords()) {
+          NFD_LOG_DEBUG("onSitContentStoreMiss interest=" << interest.getName() <<
+                        " refresh suppressed");
+          ++m_counters.getNSubscriptionRefreshesSuppressed();
+          return;
+        }
 
         // FIB lookup
         shared_ptr<fib::Entry> fibEntry = m_fib.findLongestPrefixMatch(*pitEntry);
 
-        // dispatch to strategy
-        this->dispatchToStrategy(pitEntry, bind(&Strategy::afterReceiveInterest, _1,
-                                                cref(inFace), cref(interest), fibEntry, pitEntry));
-
-        // mark interest as forwarded
-        //---pitEntry->forwardInterest(std::shared_ptr<const Face>(&inFace));
+        // dispatch to strategy;
+        // the refresh is marked as forwarded in onOutgoingInterest, if the strategy sends it
+        this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+          strategy.afterReceiveInterest(inFace, interest, fibEntry, pitEntry);
+        });
 
   }
-
-  //-----}
 }
 
 void
 Forwarder::onSitContentStoreHit(const Face& inFace,
-                             shared_ptr<pit::Entry> pitEntry,
+                             const shared_ptr<pit::Entry>& pitEntry,
                              const Interest& interest,
                              const Data& data)
 {
   NFD_LOG_DEBUG("onSitContentStoreHit interest=" << interest.getName());
 
   beforeSatisfyInterest(*pitEntry, *m_csFace, data);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeSatisfyInterest, _1,
-                                          pitEntry, cref(*m_csFace), cref(data)));
+  this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+    strategy.beforeSatisfyInterest(pitEntry, *m_csFace, data);
+  });
 
   const_pointer_cast<Data>(data.shared_from_this())->setIncomingFaceId(FACEID_CONTENT_STORE);
   // XXX should we lookup SIT for other Interests that also match csMatch?
 
-  // set SIT straggler timer
-  this->setStragglerTimer(pitEntry, true, data.getFreshnessPeriod());
-
   // goto outgoing Data pipeline
   this->onOutgoingData(data, *const_pointer_cast<Face>(inFace.shared_from_this()));
 }
 
 void
 Forwarder::onInterestLoop(Face& inFace, const Interest& interest,
-                          shared_ptr<pit::Entry> pitEntry)
+                          const shared_ptr<pit::Entry>& pitEntry)
 {
   NFD_LOG_DEBUG("onInterestLoop face=" << inFace.getId() <<
                 " interest=" << interest.getName());
@@ -324,7 +340,7 @@ compare_pickInterest(const pit::InRecord& a, const pit::InRecord& b, const Face*
 }
 
 void
-Forwarder::onOutgoingInterest(shared_ptr<pit::Entry> pitEntry, Face& outFace,
+Forwarder::onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outFace,
                               bool wantNewNonce)
 {
   if (outFace.getId() == INVALID_FACEID) {
@@ -361,10 +377,17 @@ Forwarder::onOutgoingInterest(shared_ptr<pit::Entry> pitEntry, Face& outFace,
   // send Interest
   outFace.sendInterest(*interest);
   ++m_counters.getNOutInterests();
+
+  // hard subscription refresh: mark the downstream whose Interest was sent as forwarded,
+  // so that refresh aggregation only counts refreshes that reached upstream
+  if (interest->getSubscription() > 1) {
+    static_pointer_cast<pit::SitEntry>(pitEntry)->forwardInterest(pickedInRecord->getFace());
+    ++m_counters.getNSubscriptionRefreshesForwarded();
+  }
 }
 
 void
-Forwarder::onInterestReject(shared_ptr<pit::Entry> pitEntry)
+Forwarder::onInterestReject(const shared_ptr<pit::Entry>& pitEntry)
 {
   if (pitEntry->hasUnexpiredOutRecords()) {
     NFD_LOG_ERROR("onInterestReject interest=" << pitEntry->getName() <<
@@ -381,21 +404,22 @@ Forwarder::onInterestReject(shared_ptr<pit::Entry> pitEntry)
 }
 
 void
-Forwarder::onInterestUnsatisfied(shared_ptr<pit::Entry> pitEntry)
+Forwarder::onInterestUnsatisfied(const shared_ptr<pit::Entry>& pitEntry)
 {
   NFD_LOG_DEBUG("onInterestUnsatisfied interest=" << pitEntry->getName());
 
   // invoke PIT unsatisfied callback
   beforeExpirePendingInterest(*pitEntry);
-  this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeExpirePendingInterest, _1,
-                                          pitEntry));
+  this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+    strategy.beforeExpirePendingInterest(pitEntry);
+  });
 
   // goto Interest Finalize pipeline
   this->onInterestFinalize(pitEntry, false);
 }
 
 void
-Forwarder::onInterestFinalize(shared_ptr<pit::Entry> pitEntry, bool isSatisfied,
+Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry, bool isSatisfied,
                               const time::milliseconds& dataFreshnessPeriod)
 {
   NFD_LOG_DEBUG("onInterestFinalize interest=" << pitEntry->getName() <<
@@ -430,31 +454,43 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     return;
   }
 
-  // PIT match
-  pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
-  pit::SitDataMatchResult sitMatches = m_sit.findAllDataMatches(data);
+  // PIT and SIT match
+  pit::CombinedDataMatchResult matches = m_sit.findAllPitAndSitMatches(data);
+  m_counters.getNDataMatchNameTreeEntries() += matches.nNameTreeEntries;
+  m_counters.getNDataMatchPitEntries() += matches.nPitEntries;
+  m_counters.getNDataMatchSitEntries() += matches.nSitEntries;
+
+  const pit::DataMatchResult& pitMatches = matches.pitMatches;
+  const pit::SitDataMatchResult& sitMatches = matches.sitMatches;
   if (pitMatches.begin() == pitMatches.end() && sitMatches.begin() == sitMatches.end()) {
     // goto Data unsolicited pipeline
     this->onDataUnsolicited(inFace, data);
     return;
   }
   
-  // Remove Ptr<Packet> from the Data before inserting into cache, serving two purposes
-  // - reduce amount of memory used by cached entries
-  // - remove all tags that (e.g., hop count tag) that could have been associated with Ptr<Packet>
-  //
-  // Copying of Data is relatively cheap operation, as it copies (mostly) a collection of Blocks
-  // pointing to the same underlying memory buffer.
-  shared_ptr<Data> dataCopyWithoutPacket = make_shared<Data>(data);
-  dataCopyWithoutPacket->removeTag<ns3::ndn::Ns3PacketTag>();
-
-  // CS insert
-  if (m_csFromNdnSim == nullptr)
-    m_cs.insert(*dataCopyWithoutPacket);
-  else
-    m_csFromNdnSim->Add(dataCopyWithoutPacket);
-
-  std::set<shared_ptr<Face> > pendingDownstreams;
+  // cache decision
+  if (m_cacheDecision == nullptr || m_cacheDecision->decide(inFace, data, matches)) {
+    // Remove Ptr<Packet> from the Data before inserting into cache, serving two purposes
+    // - reduce amount of memory used by cached entries
+    // - remove all tags that (e.g., hop count tag) that could have been associated with Ptr<Packet>
+    //
+    // Copying of Data is relatively cheap operation, as it copies (mostly) a collection of Blocks
+    // pointing to the same underlying memory buffer.
+    shared_ptr<Data> dataCopyWithoutPacket = make_shared<Data>(data);
+    dataCopyWithoutPacket->removeTag<ns3::ndn::Ns3PacketTag>();
+
+    // CS insert
+    if (m_csFromNdnSim == nullptr)
+      m_cs.insert(*dataCopyWithoutPacket);
+    else
+      m_csFromNdnSim->Add(dataCopyWithoutPacket);
+  }
+  else {
+    NFD_LOG_DEBUG("onIncomingData data=" << data.getName() << " not-cached");
+    ++m_counters.getNCsDeclined();
+  }
+
+  DownstreamList pendingDownstreams;
 
   // foreach PitEntry
   for (const shared_ptr<pit::Entry>& pitEntry : pitMatches) {
@@ -468,14 +504,15 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
     for (pit::InRecordCollection::const_iterator it = inRecords.begin();
                                                  it != inRecords.end(); ++it) {
       if (it->getExpiry() > time::steady_clock::now()) {
-        pendingDownstreams.insert(it->getFace());
+        pendingDownstreams.push_back(it->getFace());
       }
     }
 
     // invoke PIT satisfy callback
     beforeSatisfyInterest(*pitEntry, inFace, data);
-    this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeSatisfyInterest, _1,
-                                            pitEntry, cref(inFace), cref(data)));
+    this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+      strategy.beforeSatisfyInterest(pitEntry, inFace, data);
+    });
 
     // Dead Nonce List insert if necessary (for OutRecord of inFace)
     this->insertDeadNonceList(*pitEntry, true, data.getFreshnessPeriod(), &inFace);
@@ -489,47 +526,73 @@ Forwarder::onIncomingData(Face& inFace, const Data& data)
   }
 
   // foreach SitEntry
+  typedef std::pair<shared_ptr<Face>, pit::SitEntry*> Subscriber;
+  SmallVector<Subscriber, 16> subscribers;
   for (const shared_ptr<pit::Entry>& pitEntry : sitMatches) {
     NFD_LOG_DEBUG("onIncomingData matching=" << pitEntry->getName());
+    pit::SitEntry& sitEntry = static_cast<pit::SitEntry&>(*pitEntry);
 
-    // cancel unsatisfy & straggler timer
-    this->cancelUnsatisfyAndStragglerTimer(pitEntry);
-
-    // remember pending downstreams
+    // remember subscribers
     const pit::InRecordCollection& inRecords = pitEntry->getInRecords();
     for (pit::InRecordCollection::const_iterator it = inRecords.begin();
                                                     it != inRecords.end(); ++it) {
       if (it->getExpiry() > time::steady_clock::now()) {
-        pendingDownstreams.insert(it->getFace());
+        subscribers.push_back(Subscriber(it->getFace(), &sitEntry));
       }
     }
 
     // invoke SIT satisfy callback
     beforeSatisfyInterest(*pitEntry, inFace, data);
-    this->dispatchToStrategy(pitEntry, bind(&Strategy::beforeSatisfyInterest, _1,
-                                            pitEntry, cref(inFace), cref(data)));
+    this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+      strategy.beforeSatisfyInterest(pitEntry, inFace, data);
+    });
 
     // Dead Nonce List insert if necessary (for OutRecord of inFace)
     this->insertDeadNonceList(*pitEntry, true, data.getFreshnessPeriod(), &inFace);
 
-    // mark PIT satisfied
-    //pitEntry->deleteInRecords();
-    //pitEntry->deleteOutRecord(inFace);
+    // subscription remains until the lease of every subscriber expires
+  }
 
-    // set PIT straggler timer
-    this->setStragglerTimer(pitEntry, true, data.getFreshnessPeriod());
+  // subscription shaping
+  if (m_subscriptionShaper.size() == 0) {
+    for (const Subscriber& subscriber : subscribers) {
+      pendingDownstreams.push_back(subscriber.first);
+    }
   }
+  else {
+    // each subscriber is shaped once, under its SIT entry with the longest Name,
+    // unless it receives the Data for a PIT entry anyway
+    std::sort(subscribers.begin(), subscribers.end(),
+              [] (const Subscriber& a, const Subscriber& b) {
+                if (a.first != b.first) {
+                  return std::less<Face*>()(a.first.get(), b.first.get());
+                }
+                return a.second->getName().size() > b.second->getName().size();
+              });
+
+    const Face* lastFace = nullptr;
+    for (const Subscriber& subscriber : subscribers) {
+      const Face* face = subscriber.first.get();
+      if (face == lastFace) {
+        continue;
+      }
+      lastFace = face;
 
-  // foreach pending downstream
-  for (std::set<shared_ptr<Face> >::iterator it = pendingDownstreams.begin();
-      it != pendingDownstreams.end(); ++it) {
-    shared_ptr<Face> pendingDownstream = *it;
-    if (pendingDownstream.get() == &inFace) {
-      continue;
+      bool isPitDownstream = std::any_of(pendingDownstreams.begin(), pendingDownstreams.end(),
+        [face] (const shared_ptr<Face>& downstream) { return downstream.get() == face; });
+      if (face == &inFace || isPitDownstream) {
+        continue;
+      }
+
+      if (m_subscriptionShaper.shape(*subscriber.second, subscriber.first, data) ==
+          fw::SubscriptionShaper::ADMIT) {
+        pendingDownstreams.push_back(subscriber.first);
+      }
     }
-    // goto outgoing Data pipeline
-    this->onOutgoingData(data, *pendingDownstream);
   }
+
+  // goto outgoing Data pipeline for all pending downstreams
+  this->onOutgoingDataFanOut(data, inFace, pendingDownstreams);
 }
 
 void
@@ -576,6 +639,46 @@ Forwarder::onOutgoingData(const Data& data, Face& outFace)
   ++m_counters.getNOutDatas();
 }
 
+void
+Forwarder::onOutgoingDataFanOut(const Data& data, const Face& inFace, DownstreamList& downstreams)
+{
+  std::sort(downstreams.begin(), downstreams.end(),
+            [] (const shared_ptr<Face>& a, const shared_ptr<Face>& b) {
+              return a->getId() < b->getId();
+            });
+
+  // /localhost scope control
+  bool isLocalhostName = LOCALHOST_NAME.isPrefixOf(data.getName());
+
+  // send Data to each unique eligible downstream
+  FaceId lastId = INVALID_FACEID;
+  for (const shared_ptr<Face>& outFace : downstreams) {
+    FaceId outFaceId = outFace->getId();
+    if (outFace.get() == &inFace) {
+      continue;
+    }
+    if (outFaceId == INVALID_FACEID) {
+      NFD_LOG_WARN("onOutgoingData face=invalid data=" << data.getName());
+      continue;
+    }
+    if (outFaceId == lastId) {
+      continue;
+    }
+    lastId = outFaceId;
+
+    if (isLocalhostName && !outFace->isLocal()) {
+      NFD_LOG_DEBUG("onOutgoingData face=" << outFaceId <<
+                    " data=" << data.getName() << " violates /localhost");
+      // (drop)
+      continue;
+    }
+
+    NFD_LOG_DEBUG("onOutgoingData face=" << outFaceId << " data=" << data.getName());
+    outFace->sendData(data);
+    ++m_counters.getNOutDatas();
+  }
+}
+
 static inline bool
 compare_InRecord_expiry(const pit::InRecord& a, const pit::InRecord& b)
 {
@@ -583,7 +686,7 @@ compare_InRecord_expiry(const pit::InRecord& a, const pit::InRecord& b)
 }
 
 void
-Forwarder::setUnsatisfyTimer(shared_ptr<pit::Entry> pitEntry)
+Forwarder::setUnsatisfyTimer(const shared_ptr<pit::Entry>& pitEntry)
 {
   const pit::InRecordCollection& inRecords = pitEntry->getInRecords();
   pit::InRecordCollection::const_iterator lastExpiring =
@@ -596,34 +699,77 @@ Forwarder::setUnsatisfyTimer(shared_ptr<pit::Entry> pitEntry)
     // TODO all InRecords are already expired; will this happen?
   }
 
-  scheduler::cancel(pitEntry->m_unsatisfyTimer);
-  pitEntry->m_unsatisfyTimer = scheduler::schedule(lastExpiryFromNow,
-    bind(&Forwarder::onInterestUnsatisfied, this, pitEntry));
+  m_pitTimers.schedule(pitEntry->m_unsatisfyTimer, lastExpiryFromNow);
 }
 
 void
-Forwarder::setStragglerTimer(shared_ptr<pit::Entry> pitEntry, bool isSatisfied,
+Forwarder::setStragglerTimer(const shared_ptr<pit::Entry>& pitEntry, bool isSatisfied,
                              const time::milliseconds& dataFreshnessPeriod)
 {
   time::nanoseconds stragglerTime = time::milliseconds(100);
 
-  scheduler::cancel(pitEntry->m_stragglerTimer);
-  pitEntry->m_stragglerTimer = scheduler::schedule(stragglerTime,
-    bind(&Forwarder::onInterestFinalize, this, pitEntry, isSatisfied, dataFreshnessPeriod));
+  pitEntry->m_isSatisfied = isSatisfied;
+  pitEntry->m_dataFreshnessPeriod = dataFreshnessPeriod;
+  m_pitTimers.schedule(pitEntry->m_stragglerTimer, stragglerTime);
 }
 
 void
-Forwarder::cancelUnsatisfyAndStragglerTimer(shared_ptr<pit::Entry> pitEntry)
+Forwarder::cancelUnsatisfyAndStragglerTimer(const shared_ptr<pit::Entry>& pitEntry)
 {
-  scheduler::cancel(pitEntry->m_unsatisfyTimer);
-  scheduler::cancel(pitEntry->m_stragglerTimer);
+  pitEntry->m_unsatisfyTimer.cancel();
+  pitEntry->m_stragglerTimer.cancel();
+}
+
+void
+Forwarder::onPitTimerExpired(scheduler::WheelTimer& timer)
+{
+  pit::EntryTimer& entryTimer = static_cast<pit::EntryTimer&>(timer);
+  // keep the entry alive, because it may be erased from the table
+  shared_ptr<pit::Entry> pitEntry = entryTimer.getEntry().shared_from_this();
+
+  switch (entryTimer.getKind()) {
+  case pit::EntryTimer::UNSATISFY:
+    this->onInterestUnsatisfied(pitEntry);
+    break;
+  case pit::EntryTimer::STRAGGLER:
+    this->onInterestFinalize(pitEntry, pitEntry->m_isSatisfied, pitEntry->m_dataFreshnessPeriod);
+    break;
+  }
+}
+
+void
+Forwarder::onSitSweep()
+{
+  size_t nEntries = std::max(SIT_SWEEP_MIN_ENTRIES, m_sit.size() / SIT_SWEEP_FRACTION);
+  m_sit.sweep(nEntries, bind(&Forwarder::onSubscriptionExpired, this, _1));
+
+  m_sitSweepEvent = scheduler::schedule(SIT_SWEEP_INTERVAL, bind(&Forwarder::onSitSweep, this));
+}
+
+void
+Forwarder::onSubscriptionExpired(const shared_ptr<pit::SitEntry>& sitEntry)
+{
+  NFD_LOG_DEBUG("onSubscriptionExpired interest=" << sitEntry->getName());
+
+  // a strategy may have rejected the subscription
+  shared_ptr<pit::Entry> pitEntry = sitEntry;
+  this->cancelUnsatisfyAndStragglerTimer(pitEntry);
+
+  // invoke SIT expire callback
+  beforeExpirePendingInterest(*pitEntry);
+  this->dispatchToStrategy(pitEntry, [&] (Strategy& strategy) {
+    strategy.beforeExpirePendingInterest(pitEntry);
+  });
+
+  // Dead Nonce List insert
+  this->insertDeadNonceList(*pitEntry, false, time::milliseconds(-1), 0);
 }
 
 static inline void
-insertNonceToDnl(DeadNonceList& dnl, const pit::Entry& pitEntry,
+insertNonceToDnl(DeadNonceList& dnl, size_t nameHash, size_t nameLength,
                  const pit::OutRecord& outRecord)
 {
-  dnl.add(pitEntry.getName(), outRecord.getLastNonce());
+  dnl.add(nameHash, nameLength, outRecord.getLastNonce());
 }
 
 void
@@ -647,18 +793,24 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, bool isSatisfied,
     return;
   }
 
+  // reuse the Name hash cached in NameTree entry, unless PIT entry has been detached
+  name_tree::Entry* nameTreeEntry = m_nameTree.get(pitEntry);
+  size_t nameHash = nameTreeEntry != nullptr ? nameTreeEntry->getHash() :
+                                               name_tree::computeHash(pitEntry.getName());
+  size_t nameLength = pitEntry.getName().size();
+
   // Dead Nonce List insert
   if (upstream == 0) {
     // insert all outgoing Nonces
     const pit::OutRecordCollection& outRecords = pitEntry.getOutRecords();
     std::for_each(outRecords.begin(), outRecords.end(),
-                  bind(&insertNonceToDnl, ref(m_deadNonceList), cref(pitEntry), _1));
+                  bind(&insertNonceToDnl, ref(m_deadNonceList), nameHash, nameLength, _1));
   }
   else {
     // insert outgoing Nonce of a specific face
     pit::OutRecordCollection::const_iterator outRecord = pitEntry.getOutRecord(*upstream);
     if (outRecord != pitEntry.getOutRecords().end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      m_deadNonceList.add(nameHash, nameLength, outRecord->getLastNonce());
     }
   }
 }
@@ -28,6 +28,7 @@
 
 #include "common.hpp"
 #include "core/scheduler.hpp"
+#include "core/small-vector.hpp"
 #include "forwarder-counters.hpp"
 #include "face-table.hpp"
 #include "table/fib.hpp"
@@ -37,6 +38,8 @@
 #include "table/measurements.hpp"
 #include "table/strategy-choice.hpp"
 #include "table/dead-nonce-list.hpp"
+#include "cache-decision.hpp"
+#include "subscription-shaper.hpp"
 
 #include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
 
@@ -100,6 +103,11 @@ public: // forwarding entrypoints and tables
   Sit&
   getSit();
 
+  /** \return memory pools of PIT and SIT entries, which report pool occupancy
+   */
+  const pit::EntryPool&
+  getPitEntryPool() const;
+
   Cs&
   getCs();
 
@@ -116,6 +124,39 @@ public: // allow enabling ndnSIM content store (will be removed in the future)
   void
   setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs);
 
+public: // cache admission
+  /** \brief sets the decision whether Data satisfying pending Interests is cached
+   *  \param decision the cache decision, or nullptr to cache every satisfying Data
+   */
+  void
+  setCacheDecision(unique_ptr<fw::CacheDecision> decision);
+
+  const fw::CacheDecision*
+  getCacheDecision() const;
+
+public: // subscription aggregation
+  /** \brief sets the minimum interval between upstream refreshes of a hard subscription
+   *
+   *  A hard subscription Interest for an existing SIT entry is not forwarded upstream
+   *  if the entry was forwarded within this interval and has an unexpired OutRecord,
+   *  so that refreshes from all downstreams are coalesced.
+   *  Zero disables aggregation.
+   */
+  void
+  setSubscriptionRefreshInterval(const time::milliseconds& interval);
+
+  const time::milliseconds&
+  getSubscriptionRefreshInterval() const;
+
+  static const time::milliseconds DEFAULT_SUBSCRIPTION_REFRESH_INTERVAL;
+
+public: // subscription shaping
+  /** \return the shaper of subscribed Data delivery to each downstream,
+   *          which has no rule by default
+   */
+  fw::SubscriptionShaper&
+  getSubscriptionShaper();
+
 public:
   /** \brief trigger before PIT entry is satisfied
    *  \sa Strategy::beforeSatisfyInterest
@@ -136,53 +177,53 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   /** \brief Content Store miss pipeline
   */
   void
-  onContentStoreMiss(const Face& inFace, shared_ptr<pit::Entry> pitEntry, const Interest& interest);
+  onContentStoreMiss(const Face& inFace, const shared_ptr<pit::Entry>& pitEntry, const Interest& interest);
 
   /** \brief Content Store hit pipeline
   */
   void
-  onContentStoreHit(const Face& inFace, shared_ptr<pit::Entry> pitEntry,
+  onContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& pitEntry,
                     const Interest& interest, const Data& data);
 
   /** \brief Content Store miss pipeline for subscription interests
   */
   void
-  onSitContentStoreMiss(const Face& inFace, shared_ptr<pit::Entry> pitEntry, const Interest& interest, bool isNewEntry);
+  onSitContentStoreMiss(const Face& inFace, const shared_ptr<pit::Entry>& pitEntry, const Interest& interest, bool isNewEntry);
 
   /** \brief Content Store hit pipeline for subscription interests
   */
   void
-  onSitContentStoreHit(const Face& inFace, shared_ptr<pit::Entry> pitEntry,
+  onSitContentStoreHit(const Face& inFace, const shared_ptr<pit::Entry>& pitEntry,
                     const Interest& interest, const Data& data);
 
   /** \brief Interest loop pipeline
    */
   VIRTUAL_WITH_TESTS void
   onInterestLoop(Face& inFace, const Interest& interest,
-                 shared_ptr<pit::Entry> pitEntry);
+                 const shared_ptr<pit::Entry>& pitEntry);
 
   /** \brief outgoing Interest pipeline
    */
   VIRTUAL_WITH_TESTS void
-  onOutgoingInterest(shared_ptr<pit::Entry> pitEntry, Face& outFace,
+  onOutgoingInterest(const shared_ptr<pit::Entry>& pitEntry, Face& outFace,
                      bool wantNewNonce = false);
 
   /** \brief Interest reject pipeline
    */
   VIRTUAL_WITH_TESTS void
-  onInterestReject(shared_ptr<pit::Entry> pitEntry);
+  onInterestReject(const shared_ptr<pit::Entry>& pitEntry);
 
   /** \brief Interest unsatisfied pipeline
    */
   VIRTUAL_WITH_TESTS void
-  onInterestUnsatisfied(shared_ptr<pit::Entry> pitEntry);
+  onInterestUnsatisfied(const shared_ptr<pit::Entry>& pitEntry);
 
   /** \brief Interest finalize pipeline
    *  \param isSatisfied whether the Interest has been satisfied
    *  \param dataFreshnessPeriod FreshnessPeriod of satisfying Data
    */
   VIRTUAL_WITH_TESTS void
-  onInterestFinalize(shared_ptr<pit::Entry> pitEntry, bool isSatisfied,
+  onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry, bool isSatisfied,
                      const time::milliseconds& dataFreshnessPeriod = time::milliseconds(-1));
 
   /** \brief incoming Data pipeline
@@ -200,16 +241,50 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
   VIRTUAL_WITH_TESTS void
   onOutgoingData(const Data& data, Face& outFace);
 
+  /** \brief subscription expire pipeline
+   *
+   *  This is invoked when the lease of every subscriber of a SIT entry has expired,
+   *  before the entry is erased.
+   */
+  VIRTUAL_WITH_TESTS void
+  onSubscriptionExpired(const shared_ptr<pit::SitEntry>& sitEntry);
+
+  /** \brief pending downstreams of an incoming Data, possibly with duplicates
+   */
+  typedef SmallVector<shared_ptr<Face>, 16> DownstreamList;
+
+  /** \brief outgoing Data pipeline for every pending downstream of an incoming Data
+   *  \param downstreams pending downstreams, which are sorted by this method
+   *
+   *  Downstreams are deduplicated by FaceId, and inFace is excluded.
+   *  /localhost scope is checked once for the Data.
+   */
+  VIRTUAL_WITH_TESTS void
+  onOutgoingDataFanOut(const Data& data, const Face& inFace, DownstreamList& downstreams);
+
 PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   VIRTUAL_WITH_TESTS void
-  setUnsatisfyTimer(shared_ptr<pit::Entry> pitEntry);
+  setUnsatisfyTimer(const shared_ptr<pit::Entry>& pitEntry);
 
   VIRTUAL_WITH_TESTS void
-  setStragglerTimer(shared_ptr<pit::Entry> pitEntry, bool isSatisfied,
+  setStragglerTimer(const shared_ptr<pit::Entry>& pitEntry, bool isSatisfied,
                     const time::milliseconds& dataFreshnessPeriod = time::milliseconds(-1));
 
   VIRTUAL_WITH_TESTS void
-  cancelUnsatisfyAndStragglerTimer(shared_ptr<pit::Entry> pitEntry);
+  cancelUnsatisfyAndStragglerTimer(const shared_ptr<pit::Entry>& pitEntry);
+
+  /** \brief dispatches an expired unsatisfy or straggler timer of a PIT or SIT entry
+   */
+  void
+  onPitTimerExpired(scheduler::WheelTimer& timer);
+
+  /** \brief sweeps a part of the SIT for expired subscriptions, and reschedules itself
+   *
+   *  Each sweep visits max(SIT_SWEEP_MIN_ENTRIES, sit.size() / SIT_SWEEP_FRACTION) entries,
+   *  so that every entry is visited about once per SIT_SWEEP_INTERVAL * SIT_SWEEP_FRACTION.
+   */
+  void
+  onSitSweep();
 
   /** \brief insert Nonce to Dead Nonce List if necessary
    *  \param upstream if null, insert Nonces from all OutRecords;
@@ -220,21 +295,34 @@ PROTECTED_WITH_TESTS_ELSE_PRIVATE:
                       const time::milliseconds& dataFreshnessPeriod,
                       Face* upstream);
 
-  /// call trigger (method) on the effective strategy of pitEntry
-#ifdef WITH_TESTS
-  virtual void
-  dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(fw::Strategy*)> trigger);
-#else
+  /** \brief call trigger on the effective strategy of pitEntry
+   *  \tparam Function a callable taking fw::Strategy&, which invokes a trigger on it
+   *
+   *  The trigger is passed as a lambda and inlined, so that dispatching builds
+   *  neither a bind object nor a std::function.
+   */
   template<class Function>
   void
-  dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger);
-#endif
+  dispatchToStrategy(const shared_ptr<pit::Entry>& pitEntry, const Function& trigger);
+
+  /** \return the strategy to which triggers of pitEntry are dispatched,
+   *          which is the effective strategy of pitEntry
+   *  \note A test may override this to return nullptr, so that triggers are not dispatched.
+   */
+  VIRTUAL_WITH_TESTS fw::Strategy*
+  findDispatchStrategy(const pit::Entry& pitEntry);
 
 private:
   ForwarderCounters m_counters;
 
   FaceTable m_faceTable;
 
+  // unsatisfy and straggler timers of PIT and SIT entries
+  scheduler::TimerWheel m_pitTimers;
+
+  // PIT and SIT entries are allocated from this pool, which must be constructed before them
+  pit::EntryPool m_pitEntryPool;
+
   // tables
   NameTree       m_nameTree;
   Fib            m_fib;
@@ -247,6 +335,14 @@ private:
   shared_ptr<NullFace> m_csFace;
 
   ns3::Ptr<ns3::ndn::ContentStore> m_csFromNdnSim;
+  unique_ptr<fw::CacheDecision> m_cacheDecision;
+  time::milliseconds m_subscriptionRefreshInterval;
+  fw::SubscriptionShaper m_subscriptionShaper;
+  scheduler::EventId m_sitSweepEvent;
+
+  static const time::milliseconds SIT_SWEEP_INTERVAL;
+  static const size_t SIT_SWEEP_MIN_ENTRIES;
+  static const size_t SIT_SWEEP_FRACTION;
 
   static const Name LOCALHOST_NAME;
 
@@ -315,6 +411,12 @@ Forwarder::getSit()
   return m_sit;
 }
 
+inline const pit::EntryPool&
+Forwarder::getPitEntryPool() const
+{
+  return m_pitEntryPool;
+}
+
 inline Cs&
 Forwarder::getCs()
 {
@@ -345,17 +447,51 @@ Forwarder::setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs)
   m_csFromNdnSim = cs;
 }
 
-#ifdef WITH_TESTS
 inline void
-Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(fw::Strategy*)> trigger)
-#else
+Forwarder::setCacheDecision(unique_ptr<fw::CacheDecision> decision)
+{
+  m_cacheDecision = std::move(decision);
+}
+
+inline const fw::CacheDecision*
+Forwarder::getCacheDecision() const
+{
+  return m_cacheDecision.get();
+}
+
+inline void
+Forwarder::setSubscriptionRefreshInterval(const time::milliseconds& interval)
+{
+  BOOST_ASSERT(interval >= time::milliseconds::zero());
+  m_subscriptionRefreshInterval = interval;
+}
+
+inline const time::milliseconds&
+Forwarder::getSubscriptionRefreshInterval() const
+{
+  return m_subscriptionRefreshInterval;
+}
+
+inline fw::SubscriptionShaper&
+Forwarder::getSubscriptionShaper()
+{
+  return m_subscriptionShaper;
+}
+
+inline fw::Strategy*
+Forwarder::findDispatchStrategy(const pit::Entry& pitEntry)
+{
+  return &m_strategyChoice.findEffectiveStrategy(pitEntry);
+}
+
 template<class Function>
 inline void
-Forwarder::dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, Function trigger)
-#endif
+Forwarder::dispatchToStrategy(const shared_ptr<pit::Entry>& pitEntry, const Function& trigger)
 {
-  fw::Strategy& strategy = m_strategyChoice.findEffectiveStrategy(*pitEntry);
-  trigger(&strategy);
+  fw::Strategy* strategy = this->findDispatchStrategy(*pitEntry);
+  if (strategy != nullptr) {
+    trigger(*strategy);
+  }
 }
 
 } // namespace nfd
@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "subscription-shaper.hpp"
+#include "core/logger.hpp"
+
+#include <cmath>
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("SubscriptionShaper");
+
+class SubscriptionShaper::SitInfo : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1030;
+  }
+
+  SitInfo()
+    : state(nullptr)
+    , version(0)
+  {
+  }
+
+public:
+  /// rule of the SIT entry, valid if version equals SubscriptionShaper::m_version
+  RuleState* state;
+  uint64_t version;
+};
+
+SubscriptionShaper::Rule::Rule()
+  : rate(0.0)
+  , burst(1)
+  , mode(MODE_DROP)
+{
+}
+
+SubscriptionShaper::SubscriptionShaper(const SendCallback& send)
+  : m_version(1)
+  , m_send(send)
+{
+}
+
+void
+SubscriptionShaper::setRule(const Name& prefix, const Rule& rule)
+{
+  BOOST_ASSERT(rule.rate > 0.0);
+  BOOST_ASSERT(rule.burst > 0);
+
+  RuleState& state = m_rules[prefix];
+  this->flush(state);
+  state.rule = rule;
+  ++m_version;
+}
+
+void
+SubscriptionShaper::clearRules()
+{
+  for (auto& prefixAndState : m_rules) {
+    this->flush(prefixAndState.second);
+  }
+  m_rules.clear();
+  ++m_version;
+}
+
+const SubscriptionShaper::Rule*
+SubscriptionShaper::findRule(const Name& name) const
+{
+  const RuleState* state = this->findRuleState(name);
+  return state == nullptr ? nullptr : &state->rule;
+}
+
+const SubscriptionShaper::RuleState*
+SubscriptionShaper::findRuleState(const Name& name) const
+{
+  for (size_t prefixLength = name.size() + 1; prefixLength-- > 0;) {
+    auto it = m_rules.find(name.getPrefix(prefixLength));
+    if (it != m_rules.end()) {
+      return &it->second;
+    }
+  }
+  return nullptr;
+}
+
+SubscriptionShaper::Result
+SubscriptionShaper::shape(pit::SitEntry& sitEntry, const shared_ptr<Face>& outFace,
+                          const Data& data)
+{
+  if (m_rules.empty()) {
+    return ADMIT;
+  }
+
+  shared_ptr<SitInfo> info = sitEntry.getOrCreateStrategyInfo<SitInfo>();
+  if (info->version != m_version) {
+    info->state = const_cast<RuleState*>(this->findRuleState(sitEntry.getName()));
+    info->version = m_version;
+  }
+  if (info->state == nullptr) {
+    return ADMIT;
+  }
+  RuleState& state = *info->state;
+  const Rule& rule = state.rule;
+
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  FaceId faceId = outFace->getId();
+  bool isNewBucket = state.buckets.count(faceId) == 0;
+  Bucket& bucket = state.buckets[faceId];
+  if (isNewBucket) {
+    bucket.tokens = rule.burst;
+    bucket.lastRefill = now;
+  }
+  else {
+    refill(bucket, rule, now);
+  }
+  if (bucket.tokens >= 1.0) {
+    bucket.tokens -= 1.0;
+    return ADMIT;
+  }
+
+  if (rule.mode == MODE_DROP) {
+    NFD_LOG_DEBUG("shape face=" << faceId << " data=" << data.getName() << " drop");
+    ++outFace->getMutableCounters().getNShapedDatasDropped();
+    return DROP;
+  }
+
+  if (bucket.pending != nullptr) {
+    NFD_LOG_DEBUG("shape face=" << faceId << " data=" << data.getName() <<
+                  " supersedes " << bucket.pending->getName());
+    ++outFace->getMutableCounters().getNShapedDatasDropped();
+  }
+  else {
+    NFD_LOG_DEBUG("shape face=" << faceId << " data=" << data.getName() << " defer");
+    ++outFace->getMutableCounters().getNShapedDatasDelayed();
+    time::nanoseconds delay(static_cast<time::nanoseconds::rep>(
+      std::ceil((1.0 - bucket.tokens) / rule.rate * 1e9)));
+    RuleState* statePtr = &state;
+    bucket.releaseEvent = scheduler::schedule(delay,
+                                              [this, statePtr, faceId] {
+                                                this->release(*statePtr, faceId);
+                                              });
+  }
+  bucket.pending = data.shared_from_this();
+  bucket.face = outFace;
+  return DEFER;
+}
+
+void
+SubscriptionShaper::refill(Bucket& bucket, const Rule& rule,
+                           const time::steady_clock::TimePoint& now)
+{
+  time::nanoseconds elapsed = now - bucket.lastRefill;
+  bucket.tokens = std::min(static_cast<double>(rule.burst),
+                           bucket.tokens + rule.rate * elapsed.count() / 1e9);
+  bucket.lastRefill = now;
+}
+
+void
+SubscriptionShaper::flush(RuleState& state)
+{
+  for (auto& faceAndBucket : state.buckets) {
+    Bucket& bucket = faceAndBucket.second;
+    shared_ptr<Face> face = bucket.face.lock();
+    if (bucket.pending != nullptr && face != nullptr) {
+      m_send(*bucket.pending, *face);
+    }
+  }
+  // destructing the buckets cancels their release events
+  state.buckets.clear();
+}
+
+void
+SubscriptionShaper::release(RuleState& state, FaceId faceId)
+{
+  auto it = state.buckets.find(faceId);
+  BOOST_ASSERT(it != state.buckets.end());
+  Bucket& bucket = it->second;
+
+  shared_ptr<const Data> data;
+  data.swap(bucket.pending);
+  shared_ptr<Face> face = bucket.face.lock();
+  if (face == nullptr) {
+    // the downstream is gone
+    state.buckets.erase(it);
+    return;
+  }
+
+  refill(bucket, state.rule, time::steady_clock::now());
+  bucket.tokens = std::max(0.0, bucket.tokens - 1.0);
+  m_send(*data, *face);
+}
+
+} // namespace fw
+} // namespace nfd
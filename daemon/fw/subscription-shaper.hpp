@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SUBSCRIPTION_SHAPER_HPP
+#define NFD_DAEMON_FW_SUBSCRIPTION_SHAPER_HPP
+
+#include "face/face.hpp"
+#include "table/sit-entry.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief shapes the delivery of subscribed Data to each downstream
+ *
+ *  A shaping rule is configured on a topic prefix, and applies to every SIT entry under
+ *  that prefix, with the longest matching prefix taking precedence.
+ *  Each rule keeps one token bucket per downstream face, shared by all SIT entries under
+ *  the rule, so that a publisher burst reaches a subscriber at no more than the configured
+ *  rate, and a slow subscriber only loses its own Data instead of growing the send queue
+ *  of its face.
+ */
+class SubscriptionShaper : noncopyable
+{
+public:
+  /** \brief what happens to Data exceeding the rate
+   */
+  enum Mode {
+    /** \brief Data is dropped
+     */
+    MODE_DROP,
+
+    /** \brief Data waits for a token, replacing the Data already waiting for the same
+     *         downstream; suitable for telemetry, where only the latest value matters
+     */
+    MODE_COALESCE
+  };
+
+  /** \brief a token bucket configuration
+   */
+  struct Rule
+  {
+    Rule();
+
+    /// sustained rate, in Data per second
+    double rate;
+    /// bucket capacity, in Data
+    size_t burst;
+    Mode mode;
+  };
+
+  enum Result {
+    /** \brief Data shall be sent to the downstream now
+     */
+    ADMIT,
+
+    /** \brief Data has been dropped
+     */
+    DROP,
+
+    /** \brief Data will be sent to the downstream when a token becomes available
+     */
+    DEFER
+  };
+
+  /** \brief sends Data held back by shaping
+   */
+  typedef function<void(const Data&, Face&)> SendCallback;
+
+  explicit
+  SubscriptionShaper(const SendCallback& send);
+
+  /** \brief sets the rule for subscriptions under prefix
+   *  \pre rule.rate > 0 and rule.burst > 0
+   *
+   *  Data held back under a previous rule of prefix is sent immediately.
+   */
+  void
+  setRule(const Name& prefix, const Rule& rule);
+
+  /** \brief removes all rules
+   *
+   *  Data held back is sent immediately.
+   */
+  void
+  clearRules();
+
+  /** \return number of rules
+   */
+  size_t
+  size() const;
+
+  /** \return the rule of the longest prefix of name, or nullptr if none applies
+   */
+  const Rule*
+  findRule(const Name& name) const;
+
+  /** \brief decides whether data matching sitEntry shall be sent to outFace now
+   *  \pre shape is invoked at most once per Data and downstream; if the downstream has
+   *       several matching SIT entries, sitEntry should be the one with the longest Name
+   *
+   *  If the result is DEFER, data is later passed to the SendCallback,
+   *  unless it is superseded by a later Data to outFace under the same rule.
+   *  Delayed Data is counted on outFace when it starts waiting,
+   *  and dropped Data, including superseded Data, when it is dropped.
+   */
+  Result
+  shape(pit::SitEntry& sitEntry, const shared_ptr<Face>& outFace, const Data& data);
+
+public:
+  /** \brief StrategyInfo on pit::SitEntry, caching the rule of the entry
+   */
+  class SitInfo;
+
+private:
+  /** \brief token bucket of one downstream
+   */
+  struct Bucket
+  {
+    double tokens;
+    time::steady_clock::TimePoint lastRefill;
+    /// Data waiting for a token, in MODE_COALESCE
+    shared_ptr<const Data> pending;
+    weak_ptr<Face> face;
+    scheduler::ScopedEventId releaseEvent;
+  };
+
+  /** \brief a rule and the buckets of its downstreams
+   */
+  struct RuleState
+  {
+    Rule rule;
+    std::unordered_map<FaceId, Bucket> buckets;
+  };
+
+  const RuleState*
+  findRuleState(const Name& name) const;
+
+  /** \brief adds the tokens accumulated since the last refill
+   */
+  static void
+  refill(Bucket& bucket, const Rule& rule, const time::steady_clock::TimePoint& now);
+
+  /** \brief sends all Data held back under state, and discards its buckets
+   */
+  void
+  flush(RuleState& state);
+
+  void
+  release(RuleState& state, FaceId faceId);
+
+private:
+  std::map<Name, RuleState> m_rules;
+  /// incremented whenever rules change, invalidates SitInfo
+  uint64_t m_version;
+  SendCallback m_send;
+};
+
+inline size_t
+SubscriptionShaper::size() const
+{
+  return m_rules.size();
+}
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SUBSCRIPTION_SHAPER_HPP
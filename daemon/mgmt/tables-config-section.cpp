@@ -29,22 +29,29 @@
 #include "core/logger.hpp"
 #include "core/config-file.hpp"
 
+#include <limits>
+
 namespace nfd {
 
 NFD_LOG_INIT("TablesConfigSection");
 
 const size_t TablesConfigSection::DEFAULT_CS_MAX_PACKETS = 65536;
+const size_t TablesConfigSection::DEFAULT_CS_MAX_BYTES = std::numeric_limits<size_t>::max();
 
 TablesConfigSection::TablesConfigSection(Cs& cs,
                                          Pit& pit,
                                          Fib& fib,
                                          StrategyChoice& strategyChoice,
-                                         Measurements& measurements)
+                                         Measurements& measurements,
+                                         fw::SubscriptionShaper* subscriptionShaper,
+                                         DeadNonceList* deadNonceList)
   : m_cs(cs)
   // , m_pit(pit)
   // , m_fib(fib)
   , m_strategyChoice(strategyChoice)
   // , m_measurements(measurements)
+  , m_subscriptionShaper(subscriptionShaper)
+  , m_deadNonceList(deadNonceList)
   , m_areTablesConfigured(false)
 {
 
@@ -68,6 +75,7 @@ TablesConfigSection::ensureTablesAreConfigured()
 
   NFD_LOG_INFO("Setting CS max packets to " << DEFAULT_CS_MAX_PACKETS);
   m_cs.setLimit(DEFAULT_CS_MAX_PACKETS);
+  m_cs.setByteLimit(DEFAULT_CS_MAX_BYTES);
 
   m_areTablesConfigured = true;
 }
@@ -80,6 +88,8 @@ TablesConfigSection::onConfig(const ConfigSection& configSection,
   // tables
   // {
   //    cs_max_packets 65536
+  //    cs_max_bytes 536870912
+  //    cs_policy fifo
   //
   //    strategy_choice
   //    {
@@ -88,6 +98,22 @@ TablesConfigSection::onConfig(const ConfigSection& configSection,
   //       /localhost/nfd  /localhost/nfd/strategy/best-route
   //       /ndn/broadcast  /localhost/nfd/strategy/multicast
   //    }
+  //
+  //    subscription_shaping
+  //    {
+  //       /sensor/telemetry
+  //       {
+  //          rate 100
+  //          burst 10
+  //          mode coalesce
+  //       }
+  //    }
+  //
+  //    dead_nonce_filter
+  //    {
+  //       false_positive_rate 0.001
+  //       expected_entries 16384
+  //    }
   // }
 
   size_t nCsMaxPackets = DEFAULT_CS_MAX_PACKETS;
@@ -109,6 +135,47 @@ TablesConfigSection::onConfig(const ConfigSection& configSection,
       nCsMaxPackets = *valCsMaxPackets;
     }
 
+  size_t nCsMaxBytes = DEFAULT_CS_MAX_BYTES;
+
+  boost::optional<const ConfigSection&> csMaxBytesNode =
+    configSection.get_child_optional("cs_max_bytes");
+
+  if (csMaxBytesNode)
+    {
+      boost::optional<size_t> valCsMaxBytes =
+        configSection.get_optional<size_t>("cs_max_bytes");
+
+      if (!valCsMaxBytes || *valCsMaxBytes == 0)
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"cs_max_bytes\""
+                                                  " in \"tables\" section"));
+        }
+
+      nCsMaxBytes = *valCsMaxBytes;
+    }
+
+  unique_ptr<cs::Policy> csPolicy;
+
+  boost::optional<const ConfigSection&> csPolicyNode =
+    configSection.get_child_optional("cs_policy");
+
+  if (csPolicyNode)
+    {
+      const std::string policyName = csPolicyNode->get_value<std::string>();
+      csPolicy = cs::makePolicy(policyName);
+
+      if (csPolicy == nullptr)
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"cs_policy\""
+                                                  " in \"tables\" section"));
+        }
+    }
+  else
+    {
+      // reloading a config without cs_policy reverts to the default policy
+      csPolicy = cs::makeDefaultPolicy();
+    }
+
   boost::optional<const ConfigSection&> strategyChoiceSection =
     configSection.get_child_optional("strategy_choice");
 
@@ -117,11 +184,42 @@ TablesConfigSection::onConfig(const ConfigSection& configSection,
       processSectionStrategyChoice(*strategyChoiceSection, isDryRun);
     }
 
+  boost::optional<const ConfigSection&> subscriptionShapingSection =
+    configSection.get_child_optional("subscription_shaping");
+
+  // processed even if absent, so that reloading a config without it removes previous rules
+  processSectionSubscriptionShaping(subscriptionShapingSection ?
+                                    *subscriptionShapingSection : ConfigSection(),
+                                    isDryRun);
+
+  // processed even if absent, so that reloading a config without it restores the index
+  processSectionDeadNonceFilter(configSection.get_child_optional("dead_nonce_filter"),
+                                isDryRun);
+
   if (!isDryRun)
     {
+      if (csPolicy != nullptr && csPolicy->getName() != m_cs.getPolicy()->getName())
+        {
+          if (m_cs.size() == 0)
+            {
+              NFD_LOG_INFO("Setting CS replacement policy to " << csPolicy->getName());
+              m_cs.setPolicy(std::move(csPolicy));
+            }
+          else
+            {
+              NFD_LOG_WARN("Cannot change CS replacement policy of non-empty CS");
+            }
+        }
+
       NFD_LOG_INFO("Setting CS max packets to " << nCsMaxPackets);
 
       m_cs.setLimit(nCsMaxPackets);
+
+      if (csMaxBytesNode)
+        {
+          NFD_LOG_INFO("Setting CS max bytes to " << nCsMaxBytes);
+        }
+      m_cs.setByteLimit(nCsMaxBytes);
       m_areTablesConfigured = true;
     }
 }
@@ -184,5 +282,154 @@ TablesConfigSection::processSectionStrategyChoice(const ConfigSection& configSec
 }
 
 
+void
+TablesConfigSection::processSectionSubscriptionShaping(const ConfigSection& configSection,
+                                                       bool isDryRun)
+{
+  // subscription_shaping
+  // {
+  //   /sensor/telemetry
+  //   {
+  //     rate 100       ; Data per second to each subscriber
+  //     burst 10       ; optional, default 1
+  //     mode coalesce  ; optional, drop (default) or coalesce
+  //   }
+  // }
+
+  std::map<Name, fw::SubscriptionShaper::Rule> rules;
+
+  for (const auto& prefixAndRule : configSection)
+    {
+      const Name prefix(prefixAndRule.first);
+      if (rules.find(prefix) != rules.end())
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Duplicate shaping rule for prefix \"" +
+                                                  prefix.toUri() + "\" in "
+                                                  "\"subscription_shaping\" section"));
+        }
+
+      const ConfigSection& ruleSection = prefixAndRule.second;
+      fw::SubscriptionShaper::Rule rule;
+
+      boost::optional<double> rate = ruleSection.get_optional<double>("rate");
+      if (!rate || !(*rate > 0.0))
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"rate\" of prefix \"" +
+                                                  prefix.toUri() + "\" in "
+                                                  "\"subscription_shaping\" section"));
+        }
+      rule.rate = *rate;
+
+      if (ruleSection.get_child_optional("burst"))
+        {
+          boost::optional<size_t> burst = ruleSection.get_optional<size_t>("burst");
+          if (!burst || *burst == 0)
+            {
+              BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"burst\" of "
+                                                      "prefix \"" + prefix.toUri() + "\" in "
+                                                      "\"subscription_shaping\" section"));
+            }
+          rule.burst = *burst;
+        }
+
+      const std::string mode = ruleSection.get<std::string>("mode", "drop");
+      if (mode == "drop")
+        {
+          rule.mode = fw::SubscriptionShaper::MODE_DROP;
+        }
+      else if (mode == "coalesce")
+        {
+          rule.mode = fw::SubscriptionShaper::MODE_COALESCE;
+        }
+      else
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option \"mode\" of prefix \"" +
+                                                  prefix.toUri() + "\" in "
+                                                  "\"subscription_shaping\" section"));
+        }
+
+      rules[prefix] = rule;
+    }
+
+  if (isDryRun || m_subscriptionShaper == nullptr)
+    {
+      return;
+    }
+
+  m_subscriptionShaper->clearRules();
+  for (const auto& prefixAndRule : rules)
+    {
+      NFD_LOG_INFO("Setting subscription shaping on " << prefixAndRule.first <<
+                   " to " << prefixAndRule.second.rate << " Data/s");
+      m_subscriptionShaper->setRule(prefixAndRule.first, prefixAndRule.second);
+    }
+}
+
+void
+TablesConfigSection::processSectionDeadNonceFilter(
+  const boost::optional<const ConfigSection&>& configSection,
+  bool isDryRun)
+{
+  // dead_nonce_filter
+  // {
+  //   false_positive_rate 0.001  ; optional, target false positive rate of the Nonce check
+  //   expected_entries 16384     ; optional, Nonces added in each MARK interval
+  // }
+
+  if (!configSection)
+    {
+      if (!isDryRun && m_deadNonceList != nullptr)
+        {
+          m_deadNonceList->disableFilter();
+        }
+      return;
+    }
+
+  const DeadNonceFilter::Options defaults;
+
+  double falsePositiveRate = defaults.falsePositiveRate;
+  if (configSection->get_child_optional("false_positive_rate"))
+    {
+      boost::optional<double> rate = configSection->get_optional<double>("false_positive_rate");
+      if (!rate || !(*rate > 0.0 && *rate < 1.0))
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option "
+                                                  "\"false_positive_rate\" in "
+                                                  "\"dead_nonce_filter\" section"));
+        }
+      falsePositiveRate = *rate;
+    }
+
+  size_t nExpectedEntries = defaults.nExpectedEntries;
+  if (configSection->get_child_optional("expected_entries"))
+    {
+      boost::optional<size_t> entries = configSection->get_optional<size_t>("expected_entries");
+      if (!entries || *entries == 0)
+        {
+          BOOST_THROW_EXCEPTION(ConfigFile::Error("Invalid value for option "
+                                                  "\"expected_entries\" in "
+                                                  "\"dead_nonce_filter\" section"));
+        }
+      nExpectedEntries = *entries;
+    }
+
+  if (isDryRun || m_deadNonceList == nullptr)
+    {
+      return;
+    }
+
+  // enableFilter discards existing entries, so an unchanged filter is kept on reload
+  const DeadNonceFilter* filter = m_deadNonceList->getFilter();
+  if (filter != nullptr &&
+      filter->getFalsePositiveRate() == falsePositiveRate &&
+      filter->getNExpectedEntries() == nExpectedEntries)
+    {
+      return;
+    }
+
+  NFD_LOG_INFO("Setting Dead Nonce List to Bloom filters with false positive rate " <<
+               falsePositiveRate << " and " << nExpectedEntries << " expected entries");
+  m_deadNonceList->enableFilter(falsePositiveRate, nExpectedEntries);
+}
 
 } // namespace nfd
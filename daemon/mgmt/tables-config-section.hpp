@@ -31,6 +31,8 @@
 #include "table/cs.hpp"
 #include "table/measurements.hpp"
 #include "table/strategy-choice.hpp"
+#include "table/dead-nonce-list.hpp"
+#include "fw/subscription-shaper.hpp"
 
 #include "core/config-file.hpp"
 
@@ -39,11 +41,18 @@ namespace nfd {
 class TablesConfigSection
 {
 public:
+  /** \param subscriptionShaper if not null, rules are configured from the
+   *                            "subscription_shaping" subsection
+   *  \param deadNonceList if not null, its storage is configured from the
+   *                       "dead_nonce_filter" subsection
+   */
   TablesConfigSection(Cs& cs,
                       Pit& pit,
                       Fib& fib,
                       StrategyChoice& strategyChoice,
-                      Measurements& measurements);
+                      Measurements& measurements,
+                      fw::SubscriptionShaper* subscriptionShaper = nullptr,
+                      DeadNonceList* deadNonceList = nullptr);
 
   void
   setConfigFile(ConfigFile& configFile);
@@ -62,18 +71,29 @@ private:
   processSectionStrategyChoice(const ConfigSection& configSection,
                                bool isDryRun);
 
+  void
+  processSectionSubscriptionShaping(const ConfigSection& configSection,
+                                    bool isDryRun);
+
+  void
+  processSectionDeadNonceFilter(const boost::optional<const ConfigSection&>& configSection,
+                                bool isDryRun);
+
 private:
   Cs& m_cs;
   // Pit& m_pit;
   // Fib& m_fib;
   StrategyChoice& m_strategyChoice;
   // Measurements& m_measurements;
+  fw::SubscriptionShaper* m_subscriptionShaper;
+  DeadNonceList* m_deadNonceList;
 
   bool m_areTablesConfigured;
 
 private:
 
   static const size_t DEFAULT_CS_MAX_PACKETS;
+  static const size_t DEFAULT_CS_MAX_BYTES;
 };
 
 } // namespace nfd
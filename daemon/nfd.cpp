@@ -147,7 +147,9 @@ Nfd::initializeManagement()
                                    m_forwarder->getPit(),
                                    m_forwarder->getFib(),
                                    m_forwarder->getStrategyChoice(),
-                                   m_forwarder->getMeasurements());
+                                   m_forwarder->getMeasurements(),
+                                   &m_forwarder->getSubscriptionShaper(),
+                                   &m_forwarder->getDeadNonceList());
   tablesConfig.setConfigFile(config);
 
   m_internalFace->getValidator().setConfigFile(config);
@@ -189,7 +191,9 @@ Nfd::reloadConfigFile()
                                    m_forwarder->getPit(),
                                    m_forwarder->getFib(),
                                    m_forwarder->getStrategyChoice(),
-                                   m_forwarder->getMeasurements());
+                                   m_forwarder->getMeasurements(),
+                                   &m_forwarder->getSubscriptionShaper(),
+                                   &m_forwarder->getDeadNonceList());
 
   tablesConfig.setConfigFile(config);
 
@@ -25,6 +25,8 @@
 
 #include "cs-entry-impl.hpp"
 
+#include <algorithm>
+
 namespace nfd {
 namespace cs {
 
@@ -81,6 +83,17 @@ compareQueryWithData(const Name& queryName, const Data& data)
   }
 }
 
+/** \brief determines whether two Data packets have identical wire encoding
+ */
+static bool
+isSameWire(const Data& lhs, const Data& rhs)
+{
+  const Block& lhsWire = lhs.wireEncode();
+  const Block& rhsWire = rhs.wireEncode();
+  return lhsWire.size() == rhsWire.size() &&
+         std::equal(lhsWire.wire(), lhsWire.wire() + lhsWire.size(), rhsWire.wire());
+}
+
 int
 compareDataWithData(const Data& lhs, const Data& rhs)
 {
@@ -89,6 +102,12 @@ compareDataWithData(const Data& lhs, const Data& rhs)
     return cmp;
   }
 
+  // Name equals: a Data packet that is byte-for-byte identical to the stored one (ie. a refresh)
+  // has the same implicit digest, so the SHA-256 over a possibly large payload can be skipped
+  if (&lhs == &rhs || isSameWire(lhs, rhs)) {
+    return 0;
+  }
+
   return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
 }
 
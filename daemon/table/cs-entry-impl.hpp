@@ -27,10 +27,33 @@
 #define NFD_DAEMON_TABLE_CS_ENTRY_IMPL_HPP
 
 #include "cs-entry.hpp"
+#include "cs-internal.hpp"
 
 namespace nfd {
 namespace cs {
 
+/** \brief replacement policy state stored inline in a ContentStore entry
+ *
+ *  The fields belong to the replacement policy currently attached to the ContentStore.
+ *  A policy may use them to link the entry into intrusive cleanup queues and heaps,
+ *  so that no allocation is needed per stored entry.
+ */
+struct PolicyHook
+{
+  PolicyHook()
+    : index(0)
+    , nameHash(0)
+    , queue(0)
+  {
+  }
+
+  iterator prev;
+  iterator next;
+  size_t index;
+  size_t nameHash;
+  int queue;
+};
+
 /** \brief an Entry in ContentStore implementation
  *
  *  An Entry is either a stored Entry which contains a Data packet and related attributes,
@@ -60,15 +83,32 @@ public:
   void
   unsetUnsolicited();
 
+  /** \brief orders entries by Name, then by implicit digest
+   *
+   *  The implicit digest is computed lazily: only when two stored entries have the same Name
+   *  and different wire encoding, or when a query Name ends with an ImplicitSha256Digest
+   *  component and equals the Data Name without that component.
+   */
   bool
   operator<(const EntryImpl& other) const;
 
+  /** \return replacement policy state of this entry
+   *  \note The returned state is mutable even though Table elements are const,
+   *        because it does not participate in ordering.
+   */
+  PolicyHook&
+  getPolicyHook() const
+  {
+    return m_policyHook;
+  }
+
 private:
   bool
   isQuery() const;
 
 private:
   Name m_queryName;
+  mutable PolicyHook m_policyHook;
 };
 
 } // namespace cs
@@ -40,6 +40,31 @@ class EntryImpl;
 typedef std::set<EntryImpl> Table;
 typedef Table::const_iterator iterator;
 
+/** \brief hashes the Name pointed to by a Name pointer
+ */
+struct NamePtrHash
+{
+  size_t
+  operator()(const Name* name) const;
+};
+
+/** \brief compares the Names pointed to by two Name pointers
+ */
+struct NamePtrEqual
+{
+  bool
+  operator()(const Name* lhs, const Name* rhs) const
+  {
+    return *lhs == *rhs;
+  }
+};
+
+/** \brief maps a Data Name to the leftmost Table entry with that Name
+ *
+ *  Keys point to the Name of the Data stored in the mapped entry.
+ */
+typedef std::unordered_map<const Name*, iterator, NamePtrHash, NamePtrEqual> ExactNameIndex;
+
 } // namespace cs
 } // namespace nfd
 
@@ -33,6 +33,75 @@ namespace priority_fifo {
 
 const std::string PriorityFifoPolicy::POLICY_NAME = "fifo";
 
+void
+StaleTimeHeap::push(iterator i)
+{
+  m_heap.push_back(i);
+  i->getPolicyHook().index = m_heap.size() - 1;
+  this->siftUp(m_heap.size() - 1);
+}
+
+void
+StaleTimeHeap::erase(iterator i)
+{
+  size_t index = i->getPolicyHook().index;
+  BOOST_ASSERT(index < m_heap.size() && m_heap[index] == i);
+
+  iterator last = m_heap.back();
+  m_heap.pop_back();
+  if (index == m_heap.size()) {
+    return;
+  }
+
+  this->place(index, last);
+  this->siftUp(index);
+  this->siftDown(last->getPolicyHook().index);
+}
+
+void
+StaleTimeHeap::place(size_t index, iterator i)
+{
+  m_heap[index] = i;
+  i->getPolicyHook().index = index;
+}
+
+void
+StaleTimeHeap::siftUp(size_t index)
+{
+  iterator i = m_heap[index];
+  while (index > 0) {
+    size_t parent = (index - 1) / 2;
+    if (!(i->getStaleTime() < m_heap[parent]->getStaleTime())) {
+      break;
+    }
+    this->place(index, m_heap[parent]);
+    index = parent;
+  }
+  this->place(index, i);
+}
+
+void
+StaleTimeHeap::siftDown(size_t index)
+{
+  iterator i = m_heap[index];
+  size_t size = m_heap.size();
+  while (true) {
+    size_t child = index * 2 + 1;
+    if (child >= size) {
+      break;
+    }
+    if (child + 1 < size && m_heap[child + 1]->getStaleTime() < m_heap[child]->getStaleTime()) {
+      ++child;
+    }
+    if (!(m_heap[child]->getStaleTime() < i->getStaleTime())) {
+      break;
+    }
+    this->place(index, m_heap[child]);
+    index = child;
+  }
+  this->place(index, i);
+}
+
 PriorityFifoPolicy::PriorityFifoPolicy()
   : Policy(POLICY_NAME)
 {
@@ -61,7 +130,7 @@ PriorityFifoPolicy::doBeforeErase(iterator i)
 void
 PriorityFifoPolicy::doBeforeUse(iterator i)
 {
-  BOOST_ASSERT(m_entryInfoMap.find(i) != m_entryInfoMap.end());
+  BOOST_ASSERT(i->getPolicyHook().queue != QUEUE_NONE);
 }
 
 void
@@ -69,7 +138,7 @@ PriorityFifoPolicy::evictEntries()
 {
   BOOST_ASSERT(this->getCs() != nullptr);
 
-  while (this->getCs()->size() > this->getLimit()) {
+  while (this->isOverLimit()) {
     this->evictOne();
   }
 }
@@ -78,17 +147,16 @@ void
 PriorityFifoPolicy::evictOne()
 {
   BOOST_ASSERT(!m_queues[QUEUE_UNSOLICITED].empty() ||
-               !m_queues[QUEUE_STALE].empty() ||
                !m_queues[QUEUE_FIFO].empty());
 
   iterator i;
   if (!m_queues[QUEUE_UNSOLICITED].empty()) {
     i = m_queues[QUEUE_UNSOLICITED].front();
   }
-  else if (!m_queues[QUEUE_STALE].empty()) {
-    i = m_queues[QUEUE_STALE].front();
+  else if (!m_staleTimeHeap.empty() && m_staleTimeHeap.top()->isStale()) {
+    i = m_staleTimeHeap.top();
   }
-  else if (!m_queues[QUEUE_FIFO].empty()) {
+  else {
     i = m_queues[QUEUE_FIFO].front();
   }
 
@@ -99,57 +167,35 @@ PriorityFifoPolicy::evictOne()
 void
 PriorityFifoPolicy::attachQueue(iterator i)
 {
-  BOOST_ASSERT(m_entryInfoMap.find(i) == m_entryInfoMap.end());
+  PolicyHook& hook = i->getPolicyHook();
+  BOOST_ASSERT(hook.queue == QUEUE_NONE);
 
-  EntryInfo* entryInfo = new EntryInfo();
   if (i->isUnsolicited()) {
-    entryInfo->queueType = QUEUE_UNSOLICITED;
-  }
-  else if (i->isStale()) {
-    entryInfo->queueType = QUEUE_STALE;
+    hook.queue = QUEUE_UNSOLICITED;
   }
   else {
-    entryInfo->queueType = QUEUE_FIFO;
+    hook.queue = QUEUE_FIFO;
 
     if (i->canStale()) {
-      entryInfo->moveStaleEventId = scheduler::schedule(i->getData().getFreshnessPeriod(),
-                                              bind(&PriorityFifoPolicy::moveToStaleQueue, this, i));
+      m_staleTimeHeap.push(i);
     }
   }
 
-  Queue& queue = m_queues[entryInfo->queueType];
-  entryInfo->queueIt = queue.insert(queue.end(), i);
-  m_entryInfoMap[i] = entryInfo;
+  m_queues[hook.queue].push_back(i);
 }
 
 void
 PriorityFifoPolicy::detachQueue(iterator i)
 {
-  BOOST_ASSERT(m_entryInfoMap.find(i) != m_entryInfoMap.end());
+  PolicyHook& hook = i->getPolicyHook();
+  BOOST_ASSERT(hook.queue != QUEUE_NONE);
 
-  EntryInfo* entryInfo = m_entryInfoMap[i];
-  if (entryInfo->queueType == QUEUE_FIFO) {
-    scheduler::cancel(entryInfo->moveStaleEventId);
+  if (hook.queue == QUEUE_FIFO && i->canStale()) {
+    m_staleTimeHeap.erase(i);
   }
 
-  m_queues[entryInfo->queueType].erase(entryInfo->queueIt);
-  m_entryInfoMap.erase(i);
-}
-
-void
-PriorityFifoPolicy::moveToStaleQueue(iterator i)
-{
-  BOOST_ASSERT(m_entryInfoMap.find(i) != m_entryInfoMap.end());
-
-  EntryInfo* entryInfo = m_entryInfoMap[i];
-  BOOST_ASSERT(entryInfo->queueType == QUEUE_FIFO);
-
-  m_queues[QUEUE_FIFO].erase(entryInfo->queueIt);
-
-  entryInfo->queueType = QUEUE_STALE;
-  Queue& queue = m_queues[QUEUE_STALE];
-  entryInfo->queueIt = queue.insert(queue.end(), i);
-  m_entryInfoMap[i] = entryInfo;
+  m_queues[hook.queue].erase(i);
+  hook.queue = QUEUE_NONE;
 }
 
 } // namespace priorityfifo
@@ -27,40 +27,73 @@
 #define NFD_DAEMON_TABLE_CS_POLICY_FIFO_HPP
 
 #include "cs-policy.hpp"
+#include "cs-policy-queue.hpp"
 #include "common.hpp"
-#include "core/scheduler.hpp"
 
 namespace nfd {
 namespace cs {
 namespace priority_fifo {
 
-typedef std::list<iterator> Queue;
-typedef Queue::iterator QueueIt;
-
 enum QueueType {
+  QUEUE_NONE,
   QUEUE_UNSOLICITED,
-  QUEUE_STALE,
   QUEUE_FIFO,
   QUEUE_MAX
 };
 
-struct EntryInfo
-{
-  QueueType queueType;
-  QueueIt queueIt;
-  scheduler::EventId moveStaleEventId;
-};
+typedef PolicyQueue Queue;
 
-struct EntryItComparator
+/** \brief a binary min-heap of CS entries ordered by stale time
+ *
+ *  Heap positions are kept in the PolicyHook of each entry, so that an entry can be removed
+ *  from the middle of the heap in logarithmic time.
+ */
+class StaleTimeHeap
 {
+public:
   bool
-  operator()(const iterator& a, const iterator& b) const
+  empty() const
   {
-    return *a < *b;
+    return m_heap.empty();
   }
-};
 
-typedef std::map<iterator, EntryInfo*, EntryItComparator> EntryInfoMapFifo;
+  size_t
+  size() const
+  {
+    return m_heap.size();
+  }
+
+  /** \return the entry that becomes stale earliest
+   *  \pre !empty()
+   */
+  iterator
+  top() const
+  {
+    BOOST_ASSERT(!this->empty());
+    return m_heap.front();
+  }
+
+  void
+  push(iterator i);
+
+  /** \pre i is in this heap
+   */
+  void
+  erase(iterator i);
+
+private:
+  void
+  place(size_t index, iterator i);
+
+  void
+  siftUp(size_t index);
+
+  void
+  siftDown(size_t index);
+
+private:
+  std::vector<iterator> m_heap;
+};
 
 /** \brief Priority Fifo cs replacement policy
  *
@@ -69,6 +102,10 @@ typedef std::map<iterator, EntryInfo*, EntryItComparator> EntryInfoMapFifo;
  * forwarding of the corresponding Interest packet.
  * Next, the Data packets with expired freshness are removed.
  * Last, the Data packets are removed from the Content Store on a pure FIFO basis.
+ *
+ * Staleness is evaluated lazily at eviction time: solicited entries that can become stale
+ * are kept in a heap ordered by stale time, whose top is evicted if it is stale by then.
+ * Therefore, no timer is scheduled per entry.
  */
 class PriorityFifoPolicy : public Policy
 {
@@ -113,14 +150,9 @@ private:
   void
   detachQueue(iterator i);
 
-  /** \brief moves an entry from FIFO queue to STALE queue
-   */
-  void
-  moveToStaleQueue(iterator i);
-
 private:
   Queue m_queues[QUEUE_MAX];
-  EntryInfoMapFifo m_entryInfoMap;
+  StaleTimeHeap m_staleTimeHeap;
 };
 
 } // namespace priorityfifo
@@ -130,4 +162,4 @@ using priority_fifo::PriorityFifoPolicy;
 } // namespace cs
 } // namespace nfd
 
-#endif // NFD_DAEMON_TABLE_CS_POLICY_FIFO_HPP
\ No newline at end of file
+#endif // NFD_DAEMON_TABLE_CS_POLICY_FIFO_HPP
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-policy-queue.hpp"
+
+namespace nfd {
+namespace cs {
+
+PolicyQueue::PolicyQueue()
+  : m_size(0)
+{
+}
+
+void
+PolicyQueue::push_back(iterator i)
+{
+  if (m_size == 0) {
+    m_head = i;
+  }
+  else {
+    m_tail->getPolicyHook().next = i;
+    i->getPolicyHook().prev = m_tail;
+  }
+  m_tail = i;
+  ++m_size;
+}
+
+void
+PolicyQueue::erase(iterator i)
+{
+  BOOST_ASSERT(m_size > 0);
+  --m_size;
+  if (m_size == 0) {
+    return;
+  }
+
+  PolicyHook& hook = i->getPolicyHook();
+  if (i == m_head) {
+    m_head = hook.next;
+  }
+  else {
+    hook.prev->getPolicyHook().next = hook.next;
+  }
+
+  if (i == m_tail) {
+    m_tail = hook.prev;
+  }
+  else {
+    hook.next->getPolicyHook().prev = hook.prev;
+  }
+}
+
+void
+PolicyQueue::moveToBack(iterator i)
+{
+  if (i == m_tail) {
+    return;
+  }
+  this->erase(i);
+  this->push_back(i);
+}
+
+} // namespace cs
+} // namespace nfd
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_POLICY_QUEUE_HPP
+#define NFD_DAEMON_TABLE_CS_POLICY_QUEUE_HPP
+
+#include "cs-entry-impl.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief an intrusive first-in-first-out queue of CS entries
+ *
+ *  Links are kept in the PolicyHook of each entry, so that enqueuing an entry does not allocate.
+ *  An entry can be in at most one PolicyQueue at any moment.
+ *  A replacement policy may use it as a FIFO queue, or as an LRU queue by moving
+ *  an entry to the back whenever it is used.
+ */
+class PolicyQueue : noncopyable
+{
+public:
+  PolicyQueue();
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  /** \pre !empty()
+   */
+  iterator
+  front() const
+  {
+    BOOST_ASSERT(!this->empty());
+    return m_head;
+  }
+
+  /** \pre i is not in any queue
+   */
+  void
+  push_back(iterator i);
+
+  /** \pre i is in this queue
+   */
+  void
+  erase(iterator i);
+
+  /** \brief moves an entry to the back of this queue
+   *  \pre i is in this queue
+   */
+  void
+  moveToBack(iterator i);
+
+private:
+  iterator m_head;
+  iterator m_tail;
+  size_t m_size;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_POLICY_QUEUE_HPP
@@ -0,0 +1,275 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-policy-tinylfu.hpp"
+#include "cs.hpp"
+#include "name-tree.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tinylfu {
+
+const size_t FrequencySketch::N_ROWS;
+const uint8_t FrequencySketch::MAX_COUNT;
+
+/** \brief limits sketch memory to N_ROWS * 16M counters for very large CS
+ */
+static const size_t MAX_SKETCH_WIDTH = 1 << 24;
+
+FrequencySketch::FrequencySketch(size_t capacity)
+{
+  this->resize(capacity);
+}
+
+void
+FrequencySketch::resize(size_t capacity)
+{
+  capacity = std::max<size_t>(capacity, 16);
+
+  size_t width = 16;
+  while (width < capacity && width < MAX_SKETCH_WIDTH) {
+    width <<= 1;
+  }
+
+  m_counters.assign(N_ROWS * width, 0);
+  m_rowMask = width - 1;
+  m_sampleSize = capacity * 10;
+  m_nIncrements = 0;
+}
+
+size_t
+FrequencySketch::indexOf(size_t hash, size_t row) const
+{
+  // derive an independent position per row with a 64-bit mixing function
+  uint64_t x = static_cast<uint64_t>(hash) + (row + 1) * 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  x ^= x >> 31;
+  return row * (m_rowMask + 1) + (static_cast<size_t>(x) & m_rowMask);
+}
+
+void
+FrequencySketch::increment(size_t hash)
+{
+  bool isAdded = false;
+  for (size_t row = 0; row < N_ROWS; ++row) {
+    uint8_t& counter = m_counters[this->indexOf(hash, row)];
+    if (counter < MAX_COUNT) {
+      ++counter;
+      isAdded = true;
+    }
+  }
+
+  if (isAdded && ++m_nIncrements >= m_sampleSize) {
+    this->halve();
+  }
+}
+
+uint8_t
+FrequencySketch::estimate(size_t hash) const
+{
+  uint8_t count = MAX_COUNT;
+  for (size_t row = 0; row < N_ROWS; ++row) {
+    count = std::min(count, m_counters[this->indexOf(hash, row)]);
+  }
+  return count;
+}
+
+void
+FrequencySketch::halve()
+{
+  for (uint8_t& counter : m_counters) {
+    counter >>= 1;
+  }
+  m_nIncrements /= 2;
+}
+
+const std::string TinyLfuPolicy::POLICY_NAME = "tinylfu";
+
+TinyLfuPolicy::TinyLfuPolicy()
+  : Policy(POLICY_NAME)
+  , m_sketchLimit(0)
+  , m_windowLimit(1)
+  , m_protectedLimit(0)
+{
+}
+
+void
+TinyLfuPolicy::doAfterInsert(iterator i)
+{
+  this->adjustToLimit();
+
+  // PolicyHook::nameHash caches the Name hash, which keys the frequency sketch
+  PolicyHook& hook = i->getPolicyHook();
+  BOOST_ASSERT(hook.queue == SEGMENT_NONE);
+  hook.nameHash = name_tree::computeHash(i->getName());
+  m_sketch.increment(hook.nameHash);
+
+  this->moveToSegment(i, SEGMENT_WINDOW);
+  this->evictEntries();
+}
+
+void
+TinyLfuPolicy::doAfterRefresh(iterator i)
+{
+  this->recordUse(i);
+}
+
+void
+TinyLfuPolicy::doBeforeErase(iterator i)
+{
+  PolicyHook& hook = i->getPolicyHook();
+  BOOST_ASSERT(hook.queue != SEGMENT_NONE);
+  m_segments[hook.queue].erase(i);
+  hook.queue = SEGMENT_NONE;
+}
+
+void
+TinyLfuPolicy::doBeforeUse(iterator i)
+{
+  this->recordUse(i);
+}
+
+void
+TinyLfuPolicy::evictEntries()
+{
+  BOOST_ASSERT(this->getCs() != nullptr);
+  this->adjustToLimit();
+
+  while (this->isOverLimit()) {
+    this->evictOne();
+  }
+
+  // while CS is not full, window overflow enters probation segment without competition
+  PolicyQueue& window = m_segments[SEGMENT_WINDOW];
+  while (window.size() > m_windowLimit) {
+    this->moveToSegment(window.front(), SEGMENT_PROBATION);
+  }
+}
+
+void
+TinyLfuPolicy::evictOne()
+{
+  PolicyQueue& window = m_segments[SEGMENT_WINDOW];
+  PolicyQueue& probation = m_segments[SEGMENT_PROBATION];
+  PolicyQueue& protectedSegment = m_segments[SEGMENT_PROTECTED];
+  BOOST_ASSERT(!window.empty() || !probation.empty() || !protectedSegment.empty());
+
+  bool hasMain = !probation.empty() || !protectedSegment.empty();
+  if (!window.empty() && (window.size() > m_windowLimit || !hasMain)) {
+    iterator candidate = window.front();
+    if (!hasMain) {
+      this->evict(candidate);
+      return;
+    }
+
+    // TinyLFU admission: candidate from window competes with main area victim
+    iterator victim = !probation.empty() ? probation.front() : protectedSegment.front();
+    if (m_sketch.estimate(candidate->getPolicyHook().nameHash) >
+        m_sketch.estimate(victim->getPolicyHook().nameHash)) {
+      this->evict(victim);
+      this->moveToSegment(candidate, SEGMENT_PROBATION);
+    }
+    else {
+      this->evict(candidate);
+    }
+    return;
+  }
+
+  if (!probation.empty()) {
+    this->evict(probation.front());
+  }
+  else if (!protectedSegment.empty()) {
+    this->evict(protectedSegment.front());
+  }
+  else {
+    this->evict(window.front());
+  }
+}
+
+void
+TinyLfuPolicy::recordUse(iterator i)
+{
+  PolicyHook& hook = i->getPolicyHook();
+  BOOST_ASSERT(hook.queue != SEGMENT_NONE);
+  m_sketch.increment(hook.nameHash);
+
+  switch (hook.queue) {
+    case SEGMENT_WINDOW:
+    case SEGMENT_PROTECTED:
+      m_segments[hook.queue].moveToBack(i);
+      break;
+    case SEGMENT_PROBATION: {
+      this->moveToSegment(i, SEGMENT_PROTECTED);
+      PolicyQueue& protectedSegment = m_segments[SEGMENT_PROTECTED];
+      while (protectedSegment.size() > m_protectedLimit) {
+        this->moveToSegment(protectedSegment.front(), SEGMENT_PROBATION);
+      }
+      break;
+    }
+    default:
+      BOOST_ASSERT(false);
+      break;
+  }
+}
+
+void
+TinyLfuPolicy::moveToSegment(iterator i, SegmentType segment)
+{
+  PolicyHook& hook = i->getPolicyHook();
+  if (hook.queue != SEGMENT_NONE) {
+    m_segments[hook.queue].erase(i);
+  }
+  hook.queue = segment;
+  m_segments[segment].push_back(i);
+}
+
+void
+TinyLfuPolicy::evict(iterator i)
+{
+  PolicyHook& hook = i->getPolicyHook();
+  m_segments[hook.queue].erase(i);
+  hook.queue = SEGMENT_NONE;
+  this->emitSignal(beforeEvict, i);
+}
+
+void
+TinyLfuPolicy::adjustToLimit()
+{
+  size_t limit = this->getLimit();
+  if (limit == m_sketchLimit) {
+    return;
+  }
+
+  m_sketchLimit = limit;
+  m_sketch.resize(limit);
+  m_windowLimit = std::max<size_t>(1, limit / 100);
+  size_t mainLimit = limit > m_windowLimit ? limit - m_windowLimit : 0;
+  m_protectedLimit = mainLimit * 4 / 5;
+}
+
+} // namespace tinylfu
+} // namespace cs
+} // namespace nfd
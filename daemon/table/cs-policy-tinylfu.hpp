@@ -0,0 +1,187 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_POLICY_TINYLFU_HPP
+#define NFD_DAEMON_TABLE_CS_POLICY_TINYLFU_HPP
+
+#include "cs-policy.hpp"
+#include "cs-policy-queue.hpp"
+#include "common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tinylfu {
+
+/** \brief approximates access frequency of Names with a Count-Min sketch
+ *
+ *  Each Name hash maps to one counter in each of four rows, and the estimate is
+ *  the minimum of those counters. Counters are stored one per byte and saturate at MAX_COUNT.
+ *  After a number of increments equal to the sample size, all counters are halved,
+ *  so that the sketch tracks recent popularity.
+ */
+class FrequencySketch : noncopyable
+{
+public:
+  explicit
+  FrequencySketch(size_t capacity = 1);
+
+  /** \brief resets the sketch to track a cache of \p capacity entries
+   */
+  void
+  resize(size_t capacity);
+
+  /** \brief records one access of \p hash
+   */
+  void
+  increment(size_t hash);
+
+  /** \return estimated number of recent accesses of \p hash
+   */
+  uint8_t
+  estimate(size_t hash) const;
+
+  /** \return number of increments after which all counters are halved
+   */
+  size_t
+  getSampleSize() const
+  {
+    return m_sampleSize;
+  }
+
+private:
+  size_t
+  indexOf(size_t hash, size_t row) const;
+
+  void
+  halve();
+
+public:
+  static const size_t N_ROWS = 4;
+  static const uint8_t MAX_COUNT = 15;
+
+private:
+  std::vector<uint8_t> m_counters;
+  size_t m_rowMask;
+  size_t m_sampleSize;
+  size_t m_nIncrements;
+};
+
+enum SegmentType {
+  SEGMENT_NONE,
+  SEGMENT_WINDOW,
+  SEGMENT_PROBATION,
+  SEGMENT_PROTECTED,
+  SEGMENT_MAX
+};
+
+/** \brief TinyLFU admission in front of segmented LRU cs replacement policy
+ *
+ *  A new entry is placed in a small LRU window (1% of capacity).
+ *  When the window overflows, its least recently used entry is a candidate for the main area,
+ *  which is a segmented LRU of a probation segment and a protected segment (80% of main area).
+ *  If the CS is full, the candidate is admitted only if its estimated access frequency is
+ *  higher than that of the least recently used entry in main area, which is evicted instead.
+ *  An entry used while in probation segment is promoted into protected segment.
+ *
+ *  One-off requests, such as a scan, therefore cycle through the window and probation segment
+ *  without flushing frequently used entries.
+ *
+ *  \sa Einziger, Friedman and Manes, "TinyLFU: A Highly Efficient Cache Admission Policy"
+ */
+class TinyLfuPolicy : public Policy
+{
+public:
+  TinyLfuPolicy();
+
+  /** \return number of entries in a segment
+   */
+  size_t
+  getSegmentSize(SegmentType segment) const
+  {
+    return m_segments[segment].size();
+  }
+
+public:
+  static const std::string POLICY_NAME;
+
+private:
+  virtual void
+  doAfterInsert(iterator i) DECL_OVERRIDE;
+
+  virtual void
+  doAfterRefresh(iterator i) DECL_OVERRIDE;
+
+  virtual void
+  doBeforeErase(iterator i) DECL_OVERRIDE;
+
+  virtual void
+  doBeforeUse(iterator i) DECL_OVERRIDE;
+
+  virtual void
+  evictEntries() DECL_OVERRIDE;
+
+private:
+  /** \brief evicts one entry
+   *  \pre CS is not empty
+   */
+  void
+  evictOne();
+
+  /** \brief records an access of the entry and moves it within segmented LRU
+   */
+  void
+  recordUse(iterator i);
+
+  /** \brief moves the entry to the back of a segment
+   */
+  void
+  moveToSegment(iterator i, SegmentType segment);
+
+  /** \brief detaches the entry from its segment and emits beforeEvict signal
+   */
+  void
+  evict(iterator i);
+
+  /** \brief resizes sketch and segments if the limit has changed
+   */
+  void
+  adjustToLimit();
+
+private:
+  PolicyQueue m_segments[SEGMENT_MAX];
+  FrequencySketch m_sketch;
+  size_t m_sketchLimit;
+  size_t m_windowLimit;
+  size_t m_protectedLimit;
+};
+
+} // namespace tinylfu
+
+using tinylfu::TinyLfuPolicy;
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_POLICY_TINYLFU_HPP
@@ -26,11 +26,14 @@
 #include "cs-policy.hpp"
 #include "cs.hpp"
 
+#include <limits>
+
 namespace nfd {
 namespace cs {
 
 Policy::Policy(const std::string& policyName)
   : m_policyName(policyName)
+  , m_byteLimit(std::numeric_limits<size_t>::max())
 {
 }
 
@@ -47,6 +50,22 @@ Policy::setLimit(size_t nMaxEntries)
   this->evictEntries();
 }
 
+void
+Policy::setByteLimit(size_t nMaxBytes)
+{
+  BOOST_ASSERT(nMaxBytes > 0);
+  m_byteLimit = nMaxBytes;
+
+  this->evictEntries();
+}
+
+bool
+Policy::isOverLimit() const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  return m_cs->size() > m_limit || m_cs->getNBytes() > m_byteLimit;
+}
+
 void
 Policy::afterInsert(iterator i)
 {
@@ -73,6 +73,20 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /** \brief gets hard limit (in octets of stored Data packets)
+   */
+  size_t
+  getByteLimit() const;
+
+  /** \brief sets hard limit (in octets of stored Data packets)
+   *  \post getByteLimit() == nMaxBytes
+   *  \post cs.getNBytes() <= getByteLimit()
+   *
+   *  The policy may evict entries if necessary.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
   /** \brief emits when an entry is being evicted
    *
    *  A policy implementation should emit this signal to cause CS to erase the entry from its index.
@@ -82,6 +96,7 @@ public:
 
   /** \brief invoked by CS after a new entry is inserted
    *  \post cs.size() <= getLimit()
+   *  \post cs.getNBytes() <= getByteLimit()
    *
    *  The policy may evict entries if necessary.
    *  During this process, \p i might be evicted.
@@ -148,16 +163,26 @@ protected:
 
   /** \brief evicts zero or more entries
    *  \post CS size does not exceed hard limit
+   *  \post CS octets do not exceed byte limit
    */
   virtual void
   evictEntries() = 0;
 
+protected:
+  /** \return whether CS exceeds either the packet limit or the byte limit
+   *
+   *  A policy implementation should keep evicting entries while this returns true.
+   */
+  bool
+  isOverLimit() const;
+
 protected:
   DECLARE_SIGNAL_EMIT(beforeEvict)
 
 private:
   std::string m_policyName;
   size_t m_limit;
+  size_t m_byteLimit;
   Cs* m_cs;
 };
 
@@ -185,6 +210,12 @@ Policy::getLimit() const
   return m_limit;
 }
 
+inline size_t
+Policy::getByteLimit() const
+{
+  return m_byteLimit;
+}
+
 } // namespace cs
 } // namespace nfd
 
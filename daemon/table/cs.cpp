@@ -25,6 +25,9 @@
 
 #include "cs.hpp"
 #include "cs-policy-priority-fifo.hpp"
+#include "cs-policy-lru.hpp"
+#include "cs-policy-tinylfu.hpp"
+#include "name-tree.hpp"
 #include "core/logger.hpp"
 #include "core/algorithm.hpp"
 
@@ -44,13 +47,35 @@ static_assert(std::is_default_constructible<Cs::const_iterator>::value,
 BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Cs::const_iterator>));
 #endif // HAVE_IS_DEFAULT_CONSTRUCTIBLE
 
+size_t
+NamePtrHash::operator()(const Name* name) const
+{
+  return name_tree::computeHash(*name);
+}
+
 unique_ptr<Policy>
 makeDefaultPolicy()
 {
   return unique_ptr<Policy>(new PriorityFifoPolicy());
 }
 
+unique_ptr<Policy>
+makePolicy(const std::string& policyName)
+{
+  if (policyName == PriorityFifoPolicy::POLICY_NAME) {
+    return unique_ptr<Policy>(new PriorityFifoPolicy());
+  }
+  if (policyName == LruPolicy::POLICY_NAME) {
+    return unique_ptr<Policy>(new LruPolicy());
+  }
+  if (policyName == TinyLfuPolicy::POLICY_NAME) {
+    return unique_ptr<Policy>(new TinyLfuPolicy());
+  }
+  return nullptr;
+}
+
 Cs::Cs(size_t nMaxPackets, unique_ptr<Policy> policy)
+  : m_nBytes(0)
 {
   this->setPolicyImpl(policy);
   m_policy->setLimit(nMaxPackets);
@@ -68,14 +93,28 @@ Cs::getLimit() const
   return m_policy->getLimit();
 }
 
+void
+Cs::setByteLimit(size_t nMaxBytes)
+{
+  m_policy->setByteLimit(nMaxBytes);
+}
+
+size_t
+Cs::getByteLimit() const
+{
+  return m_policy->getByteLimit();
+}
+
 void
 Cs::setPolicy(unique_ptr<Policy> policy)
 {
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t byteLimit = m_policy->getByteLimit();
   this->setPolicyImpl(policy);
   m_policy->setLimit(limit);
+  m_policy->setByteLimit(byteLimit);
 }
 
 bool
@@ -93,6 +132,12 @@ Cs::insert(const Data& data, bool isUnsolicited)
     }
   }
 
+  size_t nBytes = data.wireEncode().size();
+  if (nBytes > m_policy->getByteLimit()) {
+    NFD_LOG_DEBUG("  exceeds-byte-limit " << nBytes);
+    return false;
+  }
+
   bool isNewEntry = false;
   iterator it;
   // use .insert because gcc46 does not support .emplace
@@ -110,6 +155,8 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    this->insertToExactNameIndex(it);
+    m_nBytes += nBytes;
     m_policy->afterInsert(it);
   }
 
@@ -128,6 +175,14 @@ Cs::find(const Interest& interest,
   bool isRightmost = interest.getChildSelector() == 1;
   NFD_LOG_DEBUG("find " << prefix << (isRightmost ? " R" : " L"));
 
+  iterator exact = this->findExact(interest);
+  if (exact != m_table.end()) {
+    NFD_LOG_DEBUG("  matching-exact " << exact->getName());
+    m_policy->beforeUse(exact);
+    hitCallback(interest, exact->getData());
+    return;
+  }
+
   iterator first = m_table.lower_bound(prefix);
   iterator last = m_table.end();
   if (prefix.size() > 0) {
@@ -152,6 +207,25 @@ Cs::find(const Interest& interest,
   hitCallback(interest, match->getData());
 }
 
+iterator
+Cs::findExact(const Interest& interest) const
+{
+  const Name& name = interest.getName();
+  if (!interest.getSelectors().empty() ||
+      (!name.empty() && name[-1].isImplicitSha256Digest())) {
+    return m_table.end();
+  }
+
+  // Without selectors, the leftmost Data under the Interest Name is the answer,
+  // and a Data with exactly the Interest Name sorts before any Data under a longer Name.
+  auto found = m_exactNameIndex.find(&name);
+  if (found == m_exactNameIndex.end()) {
+    return m_table.end();
+  }
+  BOOST_ASSERT(found->second->canSatisfy(interest));
+  return found->second;
+}
+
 iterator
 Cs::findLeftmost(const Interest& interest, iterator first, iterator last) const
 {
@@ -196,11 +270,44 @@ Cs::findRightmostAmongExact(const Interest& interest, iterator first, iterator l
   return find_last_if(first, last, bind(&EntryImpl::canSatisfy, _1, interest));
 }
 
+void
+Cs::insertToExactNameIndex(iterator it)
+{
+  const Name& name = it->getName();
+  if (it != m_table.begin() && std::prev(it)->getName() == name) {
+    // a Data with same Name and smaller digest is already indexed
+    return;
+  }
+
+  // the key must point into the indexed entry, so an existing key is replaced
+  m_exactNameIndex.erase(&name);
+  m_exactNameIndex.insert(std::make_pair(&name, it));
+}
+
+void
+Cs::eraseFromExactNameIndex(iterator it)
+{
+  const Name& name = it->getName();
+  auto found = m_exactNameIndex.find(&name);
+  if (found == m_exactNameIndex.end() || found->second != it) {
+    return;
+  }
+
+  // the key points into the erased entry, so it is replaced even if the Name stays indexed
+  m_exactNameIndex.erase(found);
+  iterator next = std::next(it);
+  if (next != m_table.end() && next->getName() == name) {
+    m_exactNameIndex.insert(std::make_pair(&next->getName(), next));
+  }
+}
+
 void
 Cs::setPolicyImpl(unique_ptr<Policy>& policy)
 {
   m_policy = std::move(policy);
   m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (iterator it) {
+      this->eraseFromExactNameIndex(it);
+      m_nBytes -= it->getData().wireEncode().size();
       m_table.erase(it);
     });
 
@@ -213,7 +320,7 @@ Cs::dump()
 {
   NFD_LOG_DEBUG("dump table");
   for (const EntryImpl& entry : m_table) {
-    NFD_LOG_TRACE(entry.getFullName());
+    NFD_LOG_TRACE(entry.getName());
   }
 }
 
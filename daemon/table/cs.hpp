@@ -35,6 +35,10 @@
  *  Each Entry contain the Data packet itself,
  *  and a few addition attributes such as the staleness of the Data packet.
  *
+ *  An exact Name index (hash table) maps each Data Name to the leftmost Table entry
+ *  with that Name, so that an Interest without selectors can be answered with one hash
+ *  probe when a Data with exactly the Interest Name is stored.
+ *
  *  The cleanup queues are three doubly linked lists which stores Table iterators.
  *  The three queues keep track of unsolicited, stale, and fresh Data packet, respectively.
  *  Table iterator is placed into, removed from, and moved between suitable queues
@@ -60,6 +64,13 @@ namespace cs {
 unique_ptr<Policy>
 makeDefaultPolicy();
 
+/** \brief creates a cs replacement policy by name
+ *  \param policyName "fifo", "lru", or "tinylfu"
+ *  \return the policy, or nullptr if \p policyName is unknown
+ */
+unique_ptr<Policy>
+makePolicy(const std::string& policyName);
+
 /** \brief represents the ContentStore
  */
 class Cs : noncopyable
@@ -69,7 +80,8 @@ public:
   Cs(size_t nMaxPackets = 10, unique_ptr<Policy> policy = makeDefaultPolicy());
 
   /** \brief inserts a Data packet
-   *  \return true
+   *  \return true if the Data packet is stored or refreshes a stored packet;
+   *          false if it must not be cached or is larger than the byte limit
    */
   bool
   insert(const Data& data, bool isUnsolicited = false);
@@ -105,6 +117,16 @@ public:
   size_t
   getLimit() const;
 
+  /** \brief changes capacity (in octets of stored Data packets)
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** \return capacity (in octets of stored Data packets)
+   */
+  size_t
+  getByteLimit() const;
+
   /** \brief changes cs replacement policy
    *  \pre size() == 0
    */
@@ -127,6 +149,14 @@ public:
     return m_table.size();
   }
 
+  /** \return total wire size of stored packets, in octets
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   dump();
@@ -178,11 +208,31 @@ private: // find
   iterator
   findRightmostAmongExact(const Interest& interest, iterator first, iterator last) const;
 
+  /** \brief find a match for an Interest without selectors via the exact Name index
+   *  \return the leftmost entry with exactly the Interest Name, or m_table.end() if none
+   */
+  iterator
+  findExact(const Interest& interest) const;
+
+private: // exact Name index
+  /** \brief adds a new Table entry to the exact Name index
+   */
+  void
+  insertToExactNameIndex(iterator it);
+
+  /** \brief removes a Table entry that is about to be erased from the exact Name index
+   */
+  void
+  eraseFromExactNameIndex(iterator it);
+
+private:
   void
   setPolicyImpl(unique_ptr<Policy>& policy);
 
 private:
   Table m_table;
+  ExactNameIndex m_exactNameIndex;
+  size_t m_nBytes;
   unique_ptr<Policy> m_policy;
   ndn::util::signal::ScopedConnection m_beforeEvictConnection;
 };
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dead-nonce-filter.hpp"
+
+#include <cmath>
+
+namespace nfd {
+
+/** \brief minimum number of bits in each filter
+ */
+static const size_t MIN_FILTER_BITS = 64;
+
+/** \brief maximum number of hash functions
+ */
+static const size_t MAX_HASHES = 16;
+
+DeadNonceFilter::Options::Options()
+  : nFilters(6)
+  , nExpectedEntries(1 << 14)
+  , falsePositiveRate(0.001)
+{
+}
+
+DeadNonceFilter::Filter::Filter()
+  : nEntries(0)
+  , nBitsSet(0)
+{
+}
+
+DeadNonceFilter::DeadNonceFilter(const Options& options)
+  : m_options(options)
+  , m_current(0)
+{
+  BOOST_ASSERT(options.nFilters >= 1);
+  BOOST_ASSERT(options.nExpectedEntries >= 1);
+  BOOST_ASSERT(options.falsePositiveRate > 0.0 && options.falsePositiveRate < 1.0);
+
+  // has() checks every live filter, so each filter gets an even share of the target rate
+  double filterRate = options.falsePositiveRate / options.nFilters;
+  double ln2 = std::log(2.0);
+  double nOptimalBits = -static_cast<double>(options.nExpectedEntries) * std::log(filterRate) /
+                        (ln2 * ln2);
+
+  size_t nBits = MIN_FILTER_BITS;
+  while (nBits < nOptimalBits) {
+    nBits <<= 1;
+  }
+  m_bitMask = nBits - 1;
+
+  double nOptimalHashes = static_cast<double>(nBits) / options.nExpectedEntries * ln2;
+  m_nHashes = std::max<size_t>(1, std::min<size_t>(MAX_HASHES,
+                                                   static_cast<size_t>(nOptimalHashes + 0.5)));
+
+  m_filters.resize(options.nFilters);
+  for (Filter& filter : m_filters) {
+    filter.words.assign(nBits / 64, 0);
+  }
+}
+
+bool
+DeadNonceFilter::has(uint64_t entry) const
+{
+  for (const Filter& filter : m_filters) {
+    if (filter.nEntries == 0) {
+      continue;
+    }
+
+    uint64_t isPresent = 1;
+    for (size_t i = 0; i < m_nHashes; ++i) {
+      size_t bit = this->getBit(entry, i);
+      isPresent &= filter.words[bit / 64] >> (bit % 64);
+    }
+    if (isPresent != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void
+DeadNonceFilter::add(uint64_t entry)
+{
+  Filter& filter = m_filters[m_current];
+  for (size_t i = 0; i < m_nHashes; ++i) {
+    size_t bit = this->getBit(entry, i);
+    uint64_t& word = filter.words[bit / 64];
+    uint64_t mask = static_cast<uint64_t>(1) << (bit % 64);
+    filter.nBitsSet += (word & mask) == 0;
+    word |= mask;
+  }
+  ++filter.nEntries;
+}
+
+void
+DeadNonceFilter::rotate()
+{
+  m_current = (m_current + 1) % m_filters.size();
+  Filter& filter = m_filters[m_current];
+  std::fill(filter.words.begin(), filter.words.end(), 0);
+  filter.nEntries = 0;
+  filter.nBitsSet = 0;
+}
+
+size_t
+DeadNonceFilter::size() const
+{
+  size_t nEntries = 0;
+  for (const Filter& filter : m_filters) {
+    nEntries += filter.nEntries;
+  }
+  return nEntries;
+}
+
+double
+DeadNonceFilter::estimateFalsePositiveRate() const
+{
+  double nBits = static_cast<double>(this->getNBitsPerFilter());
+  double pNegative = 1.0;
+  for (const Filter& filter : m_filters) {
+    double fill = filter.nBitsSet / nBits;
+    pNegative *= 1.0 - std::pow(fill, static_cast<double>(m_nHashes));
+  }
+  return 1.0 - pNegative;
+}
+
+} // namespace nfd
@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
+#define NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+/** \brief a ring of rotating Bloom filters that stores Dead Nonce List entries
+ *
+ *  Entries are added to the current filter. has() checks all filters in the ring.
+ *  rotate() clears the oldest filter and makes it current, so that an entry is kept
+ *  for between (nFilters - 1) and nFilters rotation intervals.
+ *
+ *  Memory usage is fixed at construction and does not depend on the number of entries.
+ *  Each filter is sized for an expected number of entries per rotation interval;
+ *  if more entries are added, the false positive rate rises above the configured rate.
+ */
+class DeadNonceFilter : noncopyable
+{
+public:
+  struct Options
+  {
+    Options();
+
+    /// number of filters in the ring, including the current filter
+    size_t nFilters;
+
+    /// expected number of entries added in each rotation interval
+    size_t nExpectedEntries;
+
+    /// target probability that has() returns true for an entry that has not been added
+    double falsePositiveRate;
+  };
+
+  explicit
+  DeadNonceFilter(const Options& options = Options());
+
+  /** \return true if entry may have been added in the live filters;
+   *          false if entry certainly has not been added
+   */
+  bool
+  has(uint64_t entry) const;
+
+  /** \brief adds entry to the current filter
+   */
+  void
+  add(uint64_t entry);
+
+  /** \brief clears the oldest filter and makes it current
+   */
+  void
+  rotate();
+
+  /** \return number of additions in live filters
+   */
+  size_t
+  size() const;
+
+  size_t
+  getNFilters() const
+  {
+    return m_filters.size();
+  }
+
+  size_t
+  getNBitsPerFilter() const
+  {
+    return m_bitMask + 1;
+  }
+
+  size_t
+  getNHashes() const
+  {
+    return m_nHashes;
+  }
+
+  /** \return memory used by filter bits, in octets
+   */
+  size_t
+  getMemoryUsage() const
+  {
+    return m_filters.size() * this->getNBitsPerFilter() / 8;
+  }
+
+  /** \return configured number of entries per rotation interval
+   */
+  size_t
+  getNExpectedEntries() const
+  {
+    return m_options.nExpectedEntries;
+  }
+
+  /** \return configured false positive rate
+   */
+  double
+  getFalsePositiveRate() const
+  {
+    return m_options.falsePositiveRate;
+  }
+
+  /** \return false positive rate estimated from the current fill of live filters
+   */
+  double
+  estimateFalsePositiveRate() const;
+
+private:
+  struct Filter
+  {
+    Filter();
+
+    std::vector<uint64_t> words;
+    size_t nEntries;
+    size_t nBitsSet;
+  };
+
+  /** \return position of the i-th bit of entry
+   */
+  size_t
+  getBit(uint64_t entry, size_t i) const
+  {
+    // double hashing on the two halves of a 64-bit hash
+    uint64_t h2 = (entry >> 32) | 1;
+    return static_cast<size_t>((entry + i * h2) & m_bitMask);
+  }
+
+private:
+  Options m_options;
+  std::vector<Filter> m_filters;
+  size_t m_current;
+  size_t m_bitMask;
+  size_t m_nHashes;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_DEAD_NONCE_FILTER_HPP
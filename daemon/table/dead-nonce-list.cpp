@@ -24,6 +24,7 @@
  */
 
 #include "dead-nonce-list.hpp"
+#include "name-tree.hpp"
 #include "core/city-hash.hpp"
 #include "core/logger.hpp"
 
@@ -83,31 +84,95 @@ DeadNonceList::~DeadNonceList()
 size_t
 DeadNonceList::size() const
 {
+  if (m_filter != nullptr) {
+    return m_filter->size();
+  }
   return m_queue.size() - this->countMarks();
 }
 
 bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  return this->has(name_tree::computeHash(name), name.size(), nonce);
+}
+
+bool
+DeadNonceList::has(size_t nameHash, size_t nameLength, uint32_t nonce) const
+{
+  Entry entry = DeadNonceList::makeEntry(nameHash, nameLength, nonce);
+  if (m_filter != nullptr) {
+    return m_filter->has(entry);
+  }
   return m_ht.find(entry) != m_ht.end();
 }
 
 void
 DeadNonceList::add(const Name& name, uint32_t nonce)
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  this->add(name_tree::computeHash(name), name.size(), nonce);
+}
+
+void
+DeadNonceList::add(size_t nameHash, size_t nameLength, uint32_t nonce)
+{
+  Entry entry = DeadNonceList::makeEntry(nameHash, nameLength, nonce);
+  if (m_filter != nullptr) {
+    m_filter->add(entry);
+    return;
+  }
   m_queue.push_back(entry);
 
   this->evictEntries();
 }
 
+void
+DeadNonceList::enableFilter(double falsePositiveRate, size_t nExpectedEntries)
+{
+  DeadNonceFilter::Options options;
+  options.nFilters = EXPECTED_MARK_COUNT + 1;
+  options.nExpectedEntries = nExpectedEntries;
+  options.falsePositiveRate = falsePositiveRate;
+  m_filter.reset(new DeadNonceFilter(options));
+
+  NFD_LOG_INFO("enableFilter falsePositiveRate=" << falsePositiveRate <<
+               " expectedEntries=" << nExpectedEntries <<
+               " bits=" << m_filter->getNBitsPerFilter() <<
+               " hashes=" << m_filter->getNHashes() <<
+               " memory=" << m_filter->getMemoryUsage());
+
+  // release the index, keeping only MARKs
+  m_queue.clear();
+  for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
+    m_queue.push_back(MARK);
+  }
+}
+
+void
+DeadNonceList::disableFilter()
+{
+  if (m_filter == nullptr) {
+    return;
+  }
+
+  NFD_LOG_INFO("disableFilter");
+  m_filter.reset();
+  // the index holds EXPECTED_MARK_COUNT MARKs, so entries expire after the expected lifetime
+}
+
 DeadNonceList::Entry
 DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
 {
-  Block nameWire = name.wireEncode();
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
-                            static_cast<uint64_t>(nonce));
+  return DeadNonceList::makeEntry(name_tree::computeHash(name), name.size(), nonce);
+}
+
+DeadNonceList::Entry
+DeadNonceList::makeEntry(size_t nameHash, size_t nameLength, uint32_t nonce)
+{
+  // the length separates Names whose component hashes cancel out in the XOR,
+  // such as /a/a/b and /b
+  uint64_t nameKey = Hash128to64(uint128(static_cast<uint64_t>(nameHash),
+                                         static_cast<uint64_t>(nameLength)));
+  return Hash128to64(uint128(nameKey, static_cast<uint64_t>(nonce)));
 }
 
 size_t
@@ -119,18 +184,39 @@ DeadNonceList::countMarks() const
 void
 DeadNonceList::mark()
 {
+  if (m_filter != nullptr) {
+    m_filter->rotate();
+    double estimatedRate = m_filter->estimateFalsePositiveRate();
+    if (estimatedRate > m_filter->getFalsePositiveRate()) {
+      NFD_LOG_DEBUG("mark estimatedFalsePositiveRate=" << estimatedRate <<
+                    " exceeds " << m_filter->getFalsePositiveRate());
+    }
+    else {
+      NFD_LOG_TRACE("mark estimatedFalsePositiveRate=" << estimatedRate);
+    }
+    m_markEvent = scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
+    return;
+  }
+
   m_queue.push_back(MARK);
   size_t nMarks = this->countMarks();
   m_actualMarkCounts.insert(nMarks);
 
   NFD_LOG_TRACE("mark nMarks=" << nMarks);
 
-  scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
+  m_markEvent = scheduler::schedule(m_markInterval, bind(&DeadNonceList::mark, this));
 }
 
 void
 DeadNonceList::adjustCapacity()
 {
+  if (m_filter != nullptr) {
+    // filter capacity is fixed
+    m_adjustCapacityEvent = scheduler::schedule(m_adjustCapacityInterval,
+                                                bind(&DeadNonceList::adjustCapacity, this));
+    return;
+  }
+
   std::pair<std::multiset<size_t>::iterator, std::multiset<size_t>::iterator> equalRange =
     m_actualMarkCounts.equal_range(EXPECTED_MARK_COUNT);
 
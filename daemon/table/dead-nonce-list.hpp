@@ -31,6 +31,7 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include "core/scheduler.hpp"
+#include "dead-nonce-filter.hpp"
 
 namespace nfd {
 
@@ -45,11 +46,19 @@ namespace nfd {
  *  but the probability is small, and the error is recoverable when consumer retransmits
  *  with a different Nonce.
  *
+ *  The Name part of the hash is the NameTree hash combined with the Name length.
+ *  The NameTree hash XORs component hashes, so Names of equal length that differ only in
+ *  component order (/a/b and /b/a), or in pairs of repeated components (/a/x/x and /a/y/y),
+ *  share the same key; the same Nonce under such Names is an additional false positive.
+ *
  *  To reduce memory usage, entries do not have associated timestamps. Instead,
  *  lifetime of entries is controlled by dynamically adjusting the capacity of the container.
  *  At fixed intervals, the MARK, an entry with a special value, is inserted into the container.
  *  The number of MARKs stored in the container reflects the lifetime of entries,
  *  because MARKs are inserted at fixed intervals.
+ *
+ *  Alternatively, entries can be stored in a ring of rotating Bloom filters (DeadNonceFilter),
+ *  one per MARK interval, which has fixed memory usage and a configurable false positive rate.
  */
 class DeadNonceList : noncopyable
 {
@@ -72,11 +81,28 @@ public:
   bool
   has(const Name& name, uint32_t nonce) const;
 
+  /** \brief determines if name+nonce exists
+   *  \param nameHash hash of the Name, as computed by name_tree::computeHash
+   *  \param nameLength number of components in the Name
+   *  \return true if name+nonce exists
+   *
+   *  This avoids hashing the Name when the caller has its NameTree entry.
+   */
+  bool
+  has(size_t nameHash, size_t nameLength, uint32_t nonce) const;
+
   /** \brief records name+nonce
    */
   void
   add(const Name& name, uint32_t nonce);
 
+  /** \brief records name+nonce
+   *  \param nameHash hash of the Name, as computed by name_tree::computeHash
+   *  \param nameLength number of components in the Name
+   */
+  void
+  add(size_t nameHash, size_t nameLength, uint32_t nonce);
+
   /** \return number of stored Nonces
    *  \note The return value does not contain non-Nonce entries in the index, if any.
    */
@@ -88,12 +114,41 @@ public:
   const time::nanoseconds&
   getLifetime() const;
 
+  /** \brief switches storage to a ring of rotating Bloom filters
+   *  \param falsePositiveRate target false positive rate of has()
+   *  \param nExpectedEntries expected number of additions in each MARK interval
+   *
+   *  The ring has EXPECTED_MARK_COUNT + 1 filters, and rotates at each MARK interval,
+   *  so that each entry is kept for at least the expected lifetime.
+   *  Existing entries are discarded.
+   */
+  void
+  enableFilter(double falsePositiveRate, size_t nExpectedEntries);
+
+  /** \brief switches storage back to the index
+   *
+   *  Entries in the filters are discarded.
+   */
+  void
+  disableFilter();
+
+  /** \return the Bloom filter storage, or nullptr if entries are stored in the index
+   */
+  const DeadNonceFilter*
+  getFilter() const
+  {
+    return m_filter.get();
+  }
+
 private: // Entry and Index
   typedef uint64_t Entry;
 
   static Entry
   makeEntry(const Name& name, uint32_t nonce);
 
+  static Entry
+  makeEntry(size_t nameHash, size_t nameLength, uint32_t nonce);
+
   typedef boost::multi_index_container<
     Entry,
     boost::multi_index::indexed_by<
@@ -140,6 +195,7 @@ public:
 
 private:
   time::nanoseconds m_lifetime;
+  unique_ptr<DeadNonceFilter> m_filter;
   Index m_index;
   Queue& m_queue;
   Hashtable& m_ht;
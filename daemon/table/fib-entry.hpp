@@ -27,10 +27,12 @@
 #define NFD_DAEMON_TABLE_FIB_ENTRY_HPP
 
 #include "fib-nexthop.hpp"
+#include "fib-face-index.hpp"
 
 namespace nfd {
 
 class NameTree;
+class Fib;
 namespace name_tree {
 class Entry;
 }
@@ -105,9 +107,11 @@ private:
   Name m_prefix;
   NextHopList m_nextHops;
 
-  shared_ptr<name_tree::Entry> m_nameTreeEntry;
+  name_tree::Entry* m_nameTreeEntry; // non-owning, the Name Tree Entry outlives this entry
+  FaceIndex* m_faceIndex; // non-owning, set while this entry is in a Fib
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
+  friend class nfd::Fib;
 };
 
 
@@ -0,0 +1,62 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-face-index.hpp"
+
+namespace nfd {
+namespace fib {
+
+void
+FaceIndex::insert(const Face& face, Entry& entry)
+{
+  m_index[&face].insert(&entry);
+}
+
+void
+FaceIndex::erase(const Face& face, Entry& entry)
+{
+  auto it = m_index.find(&face);
+  if (it == m_index.end()) {
+    return;
+  }
+
+  it->second.erase(&entry);
+  if (it->second.empty()) {
+    m_index.erase(it);
+  }
+}
+
+const FaceIndex::EntrySet*
+FaceIndex::find(const Face& face) const
+{
+  auto it = m_index.find(&face);
+  if (it == m_index.end()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+} // namespace fib
+} // namespace nfd
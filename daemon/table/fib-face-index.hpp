@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FIB_FACE_INDEX_HPP
+#define NFD_DAEMON_TABLE_FIB_FACE_INDEX_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+
+class Face;
+
+namespace fib {
+
+class Entry;
+
+/** \brief index of FIB entries by nexthop face
+ *
+ *  A FIB entry is indexed under each face for which it has a NextHop record,
+ *  so that the entries affected by a face can be found without enumerating the FIB.
+ */
+class FaceIndex : noncopyable
+{
+public:
+  typedef std::unordered_set<Entry*> EntrySet;
+
+  /** \brief records that entry has a NextHop record for face
+   */
+  void
+  insert(const Face& face, Entry& entry);
+
+  /** \brief records that entry no longer has a NextHop record for face
+   */
+  void
+  erase(const Face& face, Entry& entry);
+
+  /** \return entries that have a NextHop record for face, or nullptr if none
+   */
+  const EntrySet*
+  find(const Face& face) const;
+
+  /** \return number of faces that appear in the index
+   */
+  size_t
+  size() const
+  {
+    return m_index.size();
+  }
+
+private:
+  std::unordered_map<const Face*, EntrySet> m_index;
+};
+
+} // namespace fib
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FIB_FACE_INDEX_HPP
@@ -46,20 +46,29 @@ static_assert(std::is_default_constructible<Fib::const_iterator>::value,
 BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Fib::const_iterator>));
 #endif // HAVE_IS_DEFAULT_CONSTRUCTIBLE
 
+static inline bool
+predicate_NameTreeEntry_hasFibEntry(const name_tree::Entry& entry)
+{
+  return static_cast<bool>(entry.getFibEntry());
+}
+
 Fib::Fib(NameTree& nameTree)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_version(1)
 {
 }
 
 Fib::~Fib()
 {
-}
-
-static inline bool
-predicate_NameTreeEntry_hasFibEntry(const name_tree::Entry& entry)
-{
-  return static_cast<bool>(entry.getFibEntry());
+  // entries may be shared beyond the lifetime of this table
+  auto&& enumerable = m_nameTree.fullEnumerate(&predicate_NameTreeEntry_hasFibEntry);
+  for (const name_tree::Entry& nte : enumerable) {
+    shared_ptr<fib::Entry> entry = nte.getFibEntry();
+    if (entry->m_faceIndex == &m_faceIndex) {
+      entry->m_faceIndex = nullptr;
+    }
+  }
 }
 
 shared_ptr<fib::Entry>
@@ -74,15 +83,18 @@ Fib::findLongestPrefixMatch(const Name& prefix) const
 }
 
 shared_ptr<fib::Entry>
-Fib::findLongestPrefixMatch(shared_ptr<name_tree::Entry> nameTreeEntry) const
+Fib::findLongestPrefixMatch(const name_tree::Entry& nameTreeEntry) const
 {
-  shared_ptr<fib::Entry> entry = nameTreeEntry->getFibEntry();
-  if (static_cast<bool>(entry))
-    return entry;
-  nameTreeEntry = m_nameTree.findLongestPrefixMatch(nameTreeEntry,
-                                                    &predicate_NameTreeEntry_hasFibEntry);
-  if (static_cast<bool>(nameTreeEntry)) {
-    return nameTreeEntry->getFibEntry();
+  const name_tree::Entry* match = nameTreeEntry.m_fibMatch;
+  if (nameTreeEntry.m_fibMatchVersion != m_version) {
+    match = m_nameTree.findLongestPrefixMatch(nameTreeEntry,
+                                              &predicate_NameTreeEntry_hasFibEntry);
+    nameTreeEntry.m_fibMatch = match;
+    nameTreeEntry.m_fibMatchVersion = m_version;
+  }
+
+  if (match != nullptr) {
+    return match->getFibEntry();
   }
   return s_emptyEntry;
 }
@@ -90,21 +102,21 @@ Fib::findLongestPrefixMatch(shared_ptr<name_tree::Entry> nameTreeEntry) const
 shared_ptr<fib::Entry>
 Fib::findLongestPrefixMatch(const pit::Entry& pitEntry) const
 {
-  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(pitEntry);
+  const name_tree::Entry* nameTreeEntry = m_nameTree.get(pitEntry);
 
-  BOOST_ASSERT(static_cast<bool>(nameTreeEntry));
+  BOOST_ASSERT(nameTreeEntry != nullptr);
 
-  return findLongestPrefixMatch(nameTreeEntry);
+  return findLongestPrefixMatch(*nameTreeEntry);
 }
 
 shared_ptr<fib::Entry>
 Fib::findLongestPrefixMatch(const measurements::Entry& measurementsEntry) const
 {
-  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(measurementsEntry);
+  const name_tree::Entry* nameTreeEntry = m_nameTree.get(measurementsEntry);
 
-  BOOST_ASSERT(static_cast<bool>(nameTreeEntry));
+  BOOST_ASSERT(nameTreeEntry != nullptr);
 
-  return findLongestPrefixMatch(nameTreeEntry);
+  return findLongestPrefixMatch(*nameTreeEntry);
 }
 
 shared_ptr<fib::Entry>
@@ -124,17 +136,30 @@ Fib::insert(const Name& prefix)
   if (static_cast<bool>(entry))
     return std::make_pair(entry, false);
   entry = make_shared<fib::Entry>(prefix);
+  entry->m_faceIndex = &m_faceIndex;
   nameTreeEntry->setFibEntry(entry);
   ++m_nItems;
+  ++m_version;
   return std::make_pair(entry, true);
 }
 
 void
 Fib::erase(shared_ptr<name_tree::Entry> nameTreeEntry)
 {
+  shared_ptr<fib::Entry> entry = nameTreeEntry->getFibEntry();
+  if (!static_cast<bool>(entry)) {
+    return;
+  }
+
+  for (const fib::NextHop& nexthop : entry->getNextHops()) {
+    m_faceIndex.erase(*nexthop.getFace(), *entry);
+  }
+  entry->m_faceIndex = nullptr;
+
   nameTreeEntry->setFibEntry(shared_ptr<fib::Entry>());
   m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
   --m_nItems;
+  ++m_version;
 }
 
 void
@@ -149,31 +174,28 @@ Fib::erase(const Name& prefix)
 void
 Fib::erase(const fib::Entry& entry)
 {
-  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(entry);
-  if (static_cast<bool>(nameTreeEntry)) {
-    this->erase(nameTreeEntry);
+  name_tree::Entry* nameTreeEntry = m_nameTree.get(entry);
+  if (nameTreeEntry != nullptr) {
+    this->erase(nameTreeEntry->shared_from_this());
   }
 }
 
 void
 Fib::removeNextHopFromAllEntries(shared_ptr<Face> face)
 {
-  std::list<fib::Entry*> toErase;
+  const fib::FaceIndex::EntrySet* entries = m_faceIndex.find(*face);
+  if (entries == nullptr) {
+    return;
+  }
 
-  auto&& enumerable = m_nameTree.fullEnumerate(&predicate_NameTreeEntry_hasFibEntry);
-  for (const name_tree::Entry& nte : enumerable) {
-    shared_ptr<fib::Entry> entry = nte.getFibEntry();
+  // removeNextHop updates the index, so the affected entries are copied first
+  std::vector<fib::Entry*> affected(entries->begin(), entries->end());
+  for (fib::Entry* entry : affected) {
     entry->removeNextHop(face);
     if (!entry->hasNextHops()) {
-      toErase.push_back(entry.get());
-      // entry needs to be erased, but we must wait until the enumeration ends,
-      // because otherwise NameTree iterator would be invalidated
+      this->erase(*entry);
     }
   }
-
-  for (fib::Entry* entry : toErase) {
-    this->erase(*entry);
-  }
 }
 
 Fib::const_iterator
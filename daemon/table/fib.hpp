@@ -85,6 +85,7 @@ public: // mutation
   /** \brief removes the NextHop record for face in all entrites
    *
    *  This is usually invoked when face goes away.
+   *  Only the entries that have a NextHop record for face are visited.
    *  Removing the last NextHop in a FIB entry will erase the FIB entry.
    *
    *  \todo change parameter type to Face&
@@ -144,7 +145,7 @@ public: // enumeration
 
 private:
   shared_ptr<fib::Entry>
-  findLongestPrefixMatch(shared_ptr<name_tree::Entry> nameTreeEntry) const;
+  findLongestPrefixMatch(const name_tree::Entry& nameTreeEntry) const;
 
   void
   erase(shared_ptr<name_tree::Entry> nameTreeEntry);
@@ -153,6 +154,20 @@ private:
   NameTree& m_nameTree;
   size_t m_nItems;
 
+  /** \brief version of the table, incremented whenever a longest prefix match may change
+   *
+   *  The match cached on a NameTree entry is valid only if it is tagged with the
+   *  current version. Adding or removing nexthops does not change the match,
+   *  unless the last nexthop is removed and the entry is erased.
+   */
+  uint64_t m_version;
+
+  /** \brief FIB entries indexed by nexthop face
+   *
+   *  fib::Entry updates this index when a NextHop record is added or removed.
+   */
+  fib::FaceIndex m_faceIndex;
+
   /** \brief The empty FIB entry.
    *
    *  This entry has no nexthops.
@@ -30,6 +30,7 @@ namespace measurements {
 Entry::Entry(const Name& name)
   : m_name(name)
   , m_expiry(time::steady_clock::TimePoint::min())
+  , m_nameTreeEntry(nullptr)
 {
 }
 
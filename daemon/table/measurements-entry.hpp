@@ -60,7 +60,7 @@ private:
 private: // lifetime
   time::steady_clock::TimePoint m_expiry;
   scheduler::EventId m_cleanup;
-  shared_ptr<name_tree::Entry> m_nameTreeEntry;
+  name_tree::Entry* m_nameTreeEntry; // non-owning, the Name Tree Entry outlives this entry
 
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
@@ -66,14 +66,14 @@ Measurements::get(const Name& name)
 shared_ptr<Entry>
 Measurements::get(const fib::Entry& fibEntry)
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(fibEntry);
+  name_tree::Entry* nte = m_nameTree.get(fibEntry);
   return this->get(*nte);
 }
 
 shared_ptr<Entry>
 Measurements::get(const pit::Entry& pitEntry)
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(pitEntry);
+  name_tree::Entry* nte = m_nameTree.get(pitEntry);
   return this->get(*nte);
 }
 
@@ -84,8 +84,8 @@ Measurements::getParent(const Entry& child)
     return nullptr;
   }
 
-  shared_ptr<name_tree::Entry> nteChild = m_nameTree.get(child);
-  shared_ptr<name_tree::Entry> nte = nteChild->getParent();
+  name_tree::Entry* nteChild = m_nameTree.get(child);
+  name_tree::Entry* nte = nteChild->getParent();
   BOOST_ASSERT(nte != nullptr);
   return this->get(*nte);
 }
@@ -95,7 +95,7 @@ shared_ptr<Entry>
 Measurements::findLongestPrefixMatchImpl(const K& key,
                                          const measurements::EntryPredicate& pred) const
 {
-  shared_ptr<name_tree::Entry> match = m_nameTree.findLongestPrefixMatch(key,
+  auto match = m_nameTree.findLongestPrefixMatch(key,
       [pred] (const name_tree::Entry& nte) -> bool {
         shared_ptr<Entry> entry = nte.getMeasurementsEntry();
         return entry != nullptr && pred(*entry);
@@ -117,8 +117,8 @@ shared_ptr<Entry>
 Measurements::findLongestPrefixMatch(const pit::Entry& pitEntry,
                                      const measurements::EntryPredicate& pred) const
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(pitEntry);
-  return this->findLongestPrefixMatchImpl(nte, pred);
+  const name_tree::Entry* nte = m_nameTree.get(pitEntry);
+  return this->findLongestPrefixMatchImpl(*nte, pred);
 }
 
 shared_ptr<Entry>
@@ -134,7 +134,7 @@ void
 Measurements::extendLifetime(Entry& entry,
                              const time::nanoseconds& lifetime)
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(entry);
+  name_tree::Entry* nte = m_nameTree.get(entry);
   if (nte == nullptr ||
       nte->getMeasurementsEntry().get() != &entry) {
     // entry is already gone; it is a dangling reference
@@ -155,10 +155,10 @@ Measurements::extendLifetime(Entry& entry,
 void
 Measurements::cleanup(Entry& entry)
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(entry);
+  name_tree::Entry* nte = m_nameTree.get(entry);
   if (nte != nullptr) {
     nte->setMeasurementsEntry(nullptr);
-    m_nameTree.eraseEntryIfEmpty(nte);
+    m_nameTree.eraseEntryIfEmpty(nte->shared_from_this());
     m_nItems--;
   }
 }
@@ -138,7 +138,7 @@ private:
   shared_ptr<measurements::Entry>
   get(name_tree::Entry& nte);
 
-  /** \tparam K Name or shared_ptr<name_tree::Entry>
+  /** \tparam K Name or name_tree::Entry
    */
   template<typename K>
   shared_ptr<measurements::Entry>
@@ -47,6 +47,12 @@ Node::~Node()
 Entry::Entry(const Name& name)
   : m_hash(0)
   , m_prefix(name)
+  , m_parent(nullptr)
+  , m_node(nullptr)
+  , m_effectiveStrategy(nullptr)
+  , m_effectiveStrategyVersion(0)
+  , m_fibMatch(nullptr)
+  , m_fibMatchVersion(0)
 {
 }
 
@@ -69,33 +75,33 @@ void
 Entry::setFibEntry(shared_ptr<fib::Entry> fibEntry)
 {
   if (static_cast<bool>(fibEntry)) {
-    BOOST_ASSERT(!static_cast<bool>(fibEntry->m_nameTreeEntry));
+    BOOST_ASSERT(fibEntry->m_nameTreeEntry == nullptr);
   }
 
   if (static_cast<bool>(m_fibEntry)) {
-    m_fibEntry->m_nameTreeEntry.reset();
+    m_fibEntry->m_nameTreeEntry = nullptr;
   }
   m_fibEntry = fibEntry;
   if (static_cast<bool>(m_fibEntry)) {
-    m_fibEntry->m_nameTreeEntry = this->shared_from_this();
+    m_fibEntry->m_nameTreeEntry = this;
   }
 }
 
 void
-Entry::insertPitEntry(shared_ptr<pit::Entry> pitEntry)
+Entry::insertPitEntry(const shared_ptr<pit::Entry>& pitEntry)
 {
   BOOST_ASSERT(static_cast<bool>(pitEntry));
-  BOOST_ASSERT(!static_cast<bool>(pitEntry->m_nameTreeEntry));
+  BOOST_ASSERT(pitEntry->m_nameTreeEntry == nullptr);
 
   m_pitEntries.push_back(pitEntry);
-  pitEntry->m_nameTreeEntry = this->shared_from_this();
+  pitEntry->m_nameTreeEntry = this;
 }
 
 void
 Entry::erasePitEntry(shared_ptr<pit::Entry> pitEntry)
 {
   BOOST_ASSERT(static_cast<bool>(pitEntry));
-  BOOST_ASSERT(pitEntry->m_nameTreeEntry.get() == this);
+  BOOST_ASSERT(pitEntry->m_nameTreeEntry == this);
 
   std::vector<shared_ptr<pit::Entry> >::iterator it =
     std::find(m_pitEntries.begin(), m_pitEntries.end(), pitEntry);
@@ -103,24 +109,24 @@ Entry::erasePitEntry(shared_ptr<pit::Entry> pitEntry)
 
   *it = m_pitEntries.back();
   m_pitEntries.pop_back();
-  pitEntry->m_nameTreeEntry.reset();
+  pitEntry->m_nameTreeEntry = nullptr;
 }
 
 void
-Entry::insertSitEntry(shared_ptr<pit::SitEntry> pitEntry)
+Entry::insertSitEntry(const shared_ptr<pit::SitEntry>& pitEntry)
 {
   BOOST_ASSERT(static_cast<bool>(pitEntry));
-  BOOST_ASSERT(!static_cast<bool>(pitEntry->m_nameTreeEntry));
+  BOOST_ASSERT(pitEntry->m_nameTreeEntry == nullptr);
 
   m_sitEntries.push_back(pitEntry);
-  pitEntry->m_nameTreeEntry = this->shared_from_this();
+  pitEntry->m_nameTreeEntry = this;
 }
 
 void
 Entry::eraseSitEntry(shared_ptr<pit::SitEntry> pitEntry)
 {
   BOOST_ASSERT(static_cast<bool>(pitEntry));
-  BOOST_ASSERT(pitEntry->m_nameTreeEntry.get() == this);
+  BOOST_ASSERT(pitEntry->m_nameTreeEntry == this);
 
   std::vector<shared_ptr<pit::SitEntry> >::iterator it =
     std::find(m_sitEntries.begin(), m_sitEntries.end(), pitEntry);
@@ -128,22 +134,22 @@ Entry::eraseSitEntry(shared_ptr<pit::SitEntry> pitEntry)
 
   *it = m_sitEntries.back();
   m_sitEntries.pop_back();
-  pitEntry->m_nameTreeEntry.reset();
+  pitEntry->m_nameTreeEntry = nullptr;
 }
 
 void
 Entry::setMeasurementsEntry(shared_ptr<measurements::Entry> measurementsEntry)
 {
   if (static_cast<bool>(measurementsEntry)) {
-    BOOST_ASSERT(!static_cast<bool>(measurementsEntry->m_nameTreeEntry));
+    BOOST_ASSERT(measurementsEntry->m_nameTreeEntry == nullptr);
   }
 
   if (static_cast<bool>(m_measurementsEntry)) {
-    m_measurementsEntry->m_nameTreeEntry.reset();
+    m_measurementsEntry->m_nameTreeEntry = nullptr;
   }
   m_measurementsEntry = measurementsEntry;
   if (static_cast<bool>(m_measurementsEntry)) {
-    m_measurementsEntry->m_nameTreeEntry = this->shared_from_this();
+    m_measurementsEntry->m_nameTreeEntry = this;
   }
 }
 
@@ -151,15 +157,15 @@ void
 Entry::setStrategyChoiceEntry(shared_ptr<strategy_choice::Entry> strategyChoiceEntry)
 {
   if (static_cast<bool>(strategyChoiceEntry)) {
-    BOOST_ASSERT(!static_cast<bool>(strategyChoiceEntry->m_nameTreeEntry));
+    BOOST_ASSERT(strategyChoiceEntry->m_nameTreeEntry == nullptr);
   }
 
   if (static_cast<bool>(m_strategyChoiceEntry)) {
-    m_strategyChoiceEntry->m_nameTreeEntry.reset();
+    m_strategyChoiceEntry->m_nameTreeEntry = nullptr;
   }
   m_strategyChoiceEntry = strategyChoiceEntry;
   if (static_cast<bool>(m_strategyChoiceEntry)) {
-    m_strategyChoiceEntry->m_nameTreeEntry = this->shared_from_this();
+    m_strategyChoiceEntry->m_nameTreeEntry = this;
   }
 }
 
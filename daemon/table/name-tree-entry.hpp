@@ -36,6 +36,8 @@
 namespace nfd {
 
 class NameTree;
+class StrategyChoice;
+class Fib;
 
 namespace name_tree {
 
@@ -81,14 +83,21 @@ public:
   getHash() const;
 
   void
-  setParent(shared_ptr<Entry> parent);
+  setParent(Entry* parent);
 
-  shared_ptr<Entry>
+  /** \return the parent entry, non-owning
+   */
+  Entry*
   getParent() const;
 
-  std::vector<shared_ptr<Entry> >&
+  /** \return the child entries, non-owning
+   */
+  std::vector<Entry*>&
   getChildren();
 
+  const std::vector<Entry*>&
+  getChildren() const;
+
   bool
   hasChildren() const;
 
@@ -103,7 +112,7 @@ public: // attached table entries
   getFibEntry() const;
 
   void
-  insertPitEntry(shared_ptr<pit::Entry> pitEntry);
+  insertPitEntry(const shared_ptr<pit::Entry>& pitEntry);
 
   void
   erasePitEntry(shared_ptr<pit::Entry> pitEntry);
@@ -115,7 +124,7 @@ public: // attached table entries
   getPitEntries() const;
   
   void
-  insertSitEntry(shared_ptr<pit::SitEntry> pitEntry);
+  insertSitEntry(const shared_ptr<pit::SitEntry>& pitEntry);
 
   void
   eraseSitEntry(shared_ptr<pit::SitEntry> pitEntry);
@@ -144,8 +153,11 @@ private:
   // 2. fast hash table resize support
   size_t m_hash;
   Name m_prefix;
-  shared_ptr<Entry> m_parent;     // Pointing to the parent entry.
-  std::vector<shared_ptr<Entry> > m_children; // Children pointers.
+  // The Name Tree Entry is owned by its hash table Node (or slot) only, so that the
+  // tree links and the back pointers of attached entries are plain pointers.
+  // A parent outlives its children, because an entry with children is not empty.
+  Entry* m_parent;     // Pointing to the parent entry.
+  std::vector<Entry*> m_children; // Children pointers.
   shared_ptr<fib::Entry> m_fibEntry;
   std::vector<shared_ptr<pit::Entry> > m_pitEntries;
   std::vector<shared_ptr<pit::SitEntry> > m_sitEntries;
@@ -155,8 +167,20 @@ private:
   // get the Name Tree Node that is associated with this Name Tree Entry
   Node* m_node;
 
+  // Effective strategy of this prefix, cached by StrategyChoice.
+  // The cache is valid while m_effectiveStrategyVersion equals the StrategyChoice version.
+  mutable fw::Strategy* m_effectiveStrategy;
+  mutable uint64_t m_effectiveStrategyVersion;
+
+  // Longest prefix match entry with a FIB entry, or nullptr if none, cached by Fib.
+  // The cache is valid while m_fibMatchVersion equals the Fib version.
+  mutable const Entry* m_fibMatch;
+  mutable uint64_t m_fibMatchVersion;
+
   // Make private members accessible by Name Tree
   friend class nfd::NameTree;
+  friend class nfd::StrategyChoice;
+  friend class nfd::Fib;
 };
 
 inline const Name&
@@ -177,24 +201,30 @@ Entry::setHash(size_t hash)
   m_hash = hash;
 }
 
-inline shared_ptr<Entry>
+inline Entry*
 Entry::getParent() const
 {
   return m_parent;
 }
 
 inline void
-Entry::setParent(shared_ptr<Entry> parent)
+Entry::setParent(Entry* parent)
 {
   m_parent = parent;
 }
 
-inline std::vector<shared_ptr<name_tree::Entry> >&
+inline std::vector<Entry*>&
 Entry::getChildren()
 {
   return m_children;
 }
 
+inline const std::vector<Entry*>&
+Entry::getChildren() const
+{
+  return m_children;
+}
+
 inline bool
 Entry::hasChildren() const
 {
@@ -0,0 +1,255 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "name-tree-open-addressing-table.hpp"
+
+namespace nfd {
+namespace name_tree {
+
+const size_t OpenAddressingTable::MIGRATE_STEP = 8;
+
+static size_t
+roundUpToPowerOfTwo(size_t n)
+{
+  size_t powerOfTwo = 1;
+  while (powerOfTwo < n) {
+    powerOfTwo <<= 1;
+  }
+  return powerOfTwo;
+}
+
+OpenAddressingTable::Slot::Slot()
+  : hash(EMPTY)
+{
+}
+
+OpenAddressingTable::SlotArray::SlotArray()
+  : mask(0)
+{
+}
+
+OpenAddressingTable::SlotArray::SlotArray(size_t nSlots)
+  : slots(roundUpToPowerOfTwo(nSlots))
+  , mask(slots.size() - 1)
+{
+}
+
+OpenAddressingTable::OpenAddressingTable(size_t nSlots)
+  : m_current(nSlots)
+  , m_migrateIndex(0)
+{
+}
+
+size_t
+OpenAddressingTable::findSlot(const SlotArray& arr, const Entry& entry)
+{
+  size_t pos = entry.getHash() & arr.mask;
+  for (size_t n = 0; n < arr.slots.size(); ++n, pos = (pos + 1) & arr.mask) {
+    const Slot& slot = arr.slots[pos];
+    if (slot.entry.get() == &entry) {
+      return pos;
+    }
+    if (!static_cast<bool>(slot.entry) && slot.hash == EMPTY) {
+      break;
+    }
+  }
+  return arr.slots.size();
+}
+
+shared_ptr<Entry>
+OpenAddressingTable::findInArray(const SlotArray& arr, const Name& name, size_t prefixLen,
+                                 size_t hashValue)
+{
+  size_t pos = hashValue & arr.mask;
+  for (size_t n = 0; n < arr.slots.size(); ++n, pos = (pos + 1) & arr.mask) {
+    const Slot& slot = arr.slots[pos];
+    if (!static_cast<bool>(slot.entry)) {
+      if (slot.hash == EMPTY) {
+        break;
+      }
+      continue; // MOVED
+    }
+    // the Entry is only dereferenced when the cached hash value matches
+    if (slot.hash == hashValue &&
+        prefixLen == slot.entry->getPrefix().size() &&
+        slot.entry->getPrefix().isPrefixOf(name)) {
+      return slot.entry;
+    }
+  }
+  return shared_ptr<Entry>();
+}
+
+void
+OpenAddressingTable::insertToArray(SlotArray& arr, shared_ptr<Entry> entry)
+{
+  size_t pos = entry->getHash() & arr.mask;
+  for (size_t n = 0; n < arr.slots.size(); ++n, pos = (pos + 1) & arr.mask) {
+    Slot& slot = arr.slots[pos];
+    if (!static_cast<bool>(slot.entry)) {
+      slot.hash = entry->getHash();
+      slot.entry = std::move(entry);
+      return;
+    }
+  }
+  BOOST_ASSERT_MSG(false, "slot array is full");
+}
+
+void
+OpenAddressingTable::eraseFromArray(SlotArray& arr, size_t pos)
+{
+  size_t hole = pos;
+  arr.slots[hole].entry.reset();
+
+  // Move each following Entry of the cluster into the hole, unless the hole is
+  // before its home slot, in which case the Entry would become unreachable.
+  for (size_t i = (pos + 1) & arr.mask;
+       static_cast<bool>(arr.slots[i].entry);
+       i = (i + 1) & arr.mask) {
+    size_t home = arr.slots[i].hash & arr.mask;
+    if (((i - home) & arr.mask) >= ((i - hole) & arr.mask)) {
+      arr.slots[hole].hash = arr.slots[i].hash;
+      arr.slots[hole].entry = std::move(arr.slots[i].entry);
+      hole = i;
+    }
+  }
+
+  arr.slots[hole].hash = EMPTY;
+}
+
+shared_ptr<Entry>
+OpenAddressingTable::find(const Name& name, size_t prefixLen, size_t hashValue) const
+{
+  shared_ptr<Entry> entry = findInArray(m_current, name, prefixLen, hashValue);
+  if (!static_cast<bool>(entry) && this->isMigrating()) {
+    entry = findInArray(m_previous, name, prefixLen, hashValue);
+  }
+  return entry;
+}
+
+void
+OpenAddressingTable::insert(shared_ptr<Entry> entry)
+{
+  BOOST_ASSERT(static_cast<bool>(entry));
+
+  this->migrate(MIGRATE_STEP);
+  insertToArray(m_current, std::move(entry));
+}
+
+void
+OpenAddressingTable::erase(const Entry& entry)
+{
+  size_t pos = findSlot(m_current, entry);
+  if (pos < m_current.slots.size()) {
+    eraseFromArray(m_current, pos);
+  }
+  else {
+    // the previous slot array is read-only, so the slot becomes a tombstone
+    pos = findSlot(m_previous, entry);
+    BOOST_ASSERT(pos < m_previous.slots.size());
+    m_previous.slots[pos].entry.reset();
+    m_previous.slots[pos].hash = MOVED;
+  }
+
+  this->migrate(MIGRATE_STEP);
+}
+
+void
+OpenAddressingTable::resize(size_t nSlots)
+{
+  while (this->isMigrating()) {
+    this->migrate(m_previous.slots.size());
+  }
+
+  m_previous = std::move(m_current);
+  m_current = SlotArray(nSlots);
+  m_migrateIndex = 0;
+}
+
+void
+OpenAddressingTable::migrate(size_t nSlots)
+{
+  if (!this->isMigrating()) {
+    return;
+  }
+
+  size_t end = std::min(m_migrateIndex + nSlots, m_previous.slots.size());
+  for (; m_migrateIndex < end; ++m_migrateIndex) {
+    Slot& slot = m_previous.slots[m_migrateIndex];
+    if (static_cast<bool>(slot.entry)) {
+      insertToArray(m_current, std::move(slot.entry));
+      slot.entry.reset();
+      slot.hash = MOVED;
+    }
+  }
+
+  if (m_migrateIndex == m_previous.slots.size()) {
+    m_previous = SlotArray();
+    m_migrateIndex = 0;
+  }
+}
+
+Entry*
+OpenAddressingTable::findOccupied(const SlotArray& arr, size_t pos)
+{
+  for (; pos < arr.slots.size(); ++pos) {
+    if (static_cast<bool>(arr.slots[pos].entry)) {
+      return arr.slots[pos].entry.get();
+    }
+  }
+  return nullptr;
+}
+
+Entry*
+OpenAddressingTable::getFirst() const
+{
+  if (this->isMigrating()) {
+    // slots before m_migrateIndex have been migrated
+    Entry* entry = findOccupied(m_previous, m_migrateIndex);
+    if (entry != nullptr) {
+      return entry;
+    }
+  }
+  return findOccupied(m_current, 0);
+}
+
+Entry*
+OpenAddressingTable::getNext(const Entry& entry) const
+{
+  size_t pos = findSlot(m_previous, entry);
+  if (pos < m_previous.slots.size()) {
+    Entry* next = findOccupied(m_previous, pos + 1);
+    if (next != nullptr) {
+      return next;
+    }
+    return findOccupied(m_current, 0);
+  }
+
+  pos = findSlot(m_current, entry);
+  BOOST_ASSERT(pos < m_current.slots.size());
+  return findOccupied(m_current, pos + 1);
+}
+
+} // namespace name_tree
+} // namespace nfd
@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_NAME_TREE_OPEN_ADDRESSING_TABLE_HPP
+#define NFD_DAEMON_TABLE_NAME_TREE_OPEN_ADDRESSING_TABLE_HPP
+
+#include "name-tree-entry.hpp"
+
+namespace nfd {
+namespace name_tree {
+
+/**
+ * \brief Open addressing hash table of Name Tree Entries
+ * \details Each slot holds the cached hash value of an Entry next to the Entry
+ * pointer, so that a probe compares hash values within one flat array before
+ * dereferencing any Entry. Collisions are resolved by linear probing, and
+ * erase() uses backward shift deletion, so that no tombstone is left behind.
+ *
+ * resize() does not rehash all Entries at once. It allocates the new slot array,
+ * and Entries are then migrated a few slots at a time by each subsequent insert()
+ * and erase(). Until the migration completes, find() probes both arrays.
+ */
+class OpenAddressingTable : noncopyable
+{
+public:
+  /**
+   * \param nSlots The initial number of slots, rounded up to a power of two.
+   */
+  explicit
+  OpenAddressingTable(size_t nSlots);
+
+  /**
+   * \brief Get the number of slots in the current slot array
+   */
+  size_t
+  getNSlots() const;
+
+  /**
+   * \brief Whether Entries are still being migrated from a previous slot array
+   */
+  bool
+  isMigrating() const;
+
+  /**
+   * \brief Find the Entry of name.getPrefix(prefixLen) without copying the prefix.
+   * \param hashValue The hash value of the prefix.
+   * \return a null shared_ptr if this prefix is not found
+   */
+  shared_ptr<Entry>
+  find(const Name& name, size_t prefixLen, size_t hashValue) const;
+
+  /**
+   * \brief Insert an Entry
+   * \pre entry is not in the table, and its hash value has been set.
+   */
+  void
+  insert(shared_ptr<Entry> entry);
+
+  /**
+   * \brief Erase an Entry
+   * \pre entry is in the table
+   */
+  void
+  erase(const Entry& entry);
+
+  /**
+   * \brief Start migrating all Entries to a slot array of nSlots slots
+   * \details A migration that is still in progress is completed first.
+   * \param nSlots The number of slots, rounded up to a power of two.
+   */
+  void
+  resize(size_t nSlots);
+
+  /**
+   * \brief Get the first Entry in enumeration order
+   * \return a non-owning pointer, or nullptr if the table is empty
+   */
+  Entry*
+  getFirst() const;
+
+  /**
+   * \brief Get the Entry after entry in enumeration order
+   * \details Entries in the previous slot array are enumerated before those in
+   * the current slot array. insert() and erase() move Entries between and within
+   * slot arrays, so an enumeration is invalidated by them.
+   * \return a non-owning pointer, or nullptr if entry is the last one
+   */
+  Entry*
+  getNext(const Entry& entry) const;
+
+private:
+  struct Slot
+  {
+    Slot();
+
+    /// the hash value of entry; EMPTY or MOVED when entry is null
+    size_t hash;
+    shared_ptr<Entry> entry;
+  };
+
+  enum {
+    /// hash value of a slot that has never been used
+    EMPTY = 0,
+    /// hash value of a slot whose Entry was migrated or erased during a migration
+    MOVED = 1
+  };
+
+  struct SlotArray
+  {
+    SlotArray();
+
+    explicit
+    SlotArray(size_t nSlots);
+
+    std::vector<Slot> slots;
+    size_t mask;
+  };
+
+  /**
+   * \return the index of the slot that holds entry in arr,
+   *         or arr.slots.size() if entry is not there
+   */
+  static size_t
+  findSlot(const SlotArray& arr, const Entry& entry);
+
+  static shared_ptr<Entry>
+  findInArray(const SlotArray& arr, const Name& name, size_t prefixLen, size_t hashValue);
+
+  static void
+  insertToArray(SlotArray& arr, shared_ptr<Entry> entry);
+
+  /**
+   * \brief Erase the slot at pos, and shift the rest of its cluster backward
+   * \pre arr is the current slot array
+   */
+  static void
+  eraseFromArray(SlotArray& arr, size_t pos);
+
+  /**
+   * \return the first Entry in arr at or after pos
+   */
+  static Entry*
+  findOccupied(const SlotArray& arr, size_t pos);
+
+  /**
+   * \brief Migrate up to nSlots slots of the previous slot array
+   */
+  void
+  migrate(size_t nSlots);
+
+private:
+  SlotArray m_current;
+  SlotArray m_previous; // empty unless migrating
+  size_t m_migrateIndex; // next slot of m_previous to migrate
+
+  /**
+   * \brief The number of previous slots migrated by each insert() and erase().
+   * \details This is large enough that a migration completes before the current
+   * slot array reaches the enlarge or shrink threshold of NameTree.
+   */
+  static const size_t MIGRATE_STEP;
+};
+
+inline size_t
+OpenAddressingTable::getNSlots() const
+{
+  return m_current.slots.size();
+}
+
+inline bool
+OpenAddressingTable::isMigrating() const
+{
+  return !m_previous.slots.empty();
+}
+
+} // namespace name_tree
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_NAME_TREE_OPEN_ADDRESSING_TABLE_HPP
@@ -113,7 +113,7 @@ computeHashSet(const Name& prefix)
 
 } // namespace name_tree
 
-NameTree::NameTree(size_t nBuckets)
+NameTree::NameTree(size_t nBuckets, HashTableLayout layout)
   : m_nItems(0)
   , m_nBuckets(nBuckets)
   , m_minNBuckets(nBuckets)
@@ -121,23 +121,33 @@ NameTree::NameTree(size_t nBuckets)
   , m_enlargeFactor(2)       // double the hash table size
   , m_shrinkLoadFactor(0.1) // less than 10% buckets loaded
   , m_shrinkFactor(0.5)     // reduce the number of buckets by half
-  , m_endIterator(FULL_ENUMERATE_TYPE, *this, m_end)
+  , m_buckets(0)
+  , m_endIterator(FULL_ENUMERATE_TYPE, *this, nullptr)
 {
-  m_enlargeThreshold = static_cast<size_t>(m_enlargeLoadFactor *
-                                          static_cast<double>(m_nBuckets));
-
-  m_shrinkThreshold = static_cast<size_t>(m_shrinkLoadFactor *
-                                          static_cast<double>(m_nBuckets));
+  if (layout == OPEN_ADDRESSING_LAYOUT)
+    {
+      // the slot array size is a power of two
+      m_openTable.reset(new name_tree::OpenAddressingTable(nBuckets));
+      m_nBuckets = m_openTable->getNSlots();
+      m_minNBuckets = m_nBuckets;
+    }
+  else
+    {
+      // array of node pointers
+      m_buckets = new name_tree::Node*[m_nBuckets];
+      // Initialize the pointer array
+      for (size_t i = 0; i < m_nBuckets; i++)
+        m_buckets[i] = 0;
+    }
 
-  // array of node pointers
-  m_buckets = new name_tree::Node*[m_nBuckets];
-  // Initialize the pointer array
-  for (size_t i = 0; i < m_nBuckets; i++)
-    m_buckets[i] = 0;
+  updateThresholds();
 }
 
 NameTree::~NameTree()
 {
+  if (m_buckets == 0)
+    return;
+
   for (size_t i = 0; i < m_nBuckets; i++)
     {
       if (m_buckets[i] != 0) {
@@ -148,56 +158,98 @@ NameTree::~NameTree()
   delete [] m_buckets;
 }
 
-// insert() is a private function, and called by only lookup()
-std::pair<shared_ptr<name_tree::Entry>, bool>
-NameTree::insert(const Name& prefix)
+void
+NameTree::updateThresholds()
 {
-  NFD_LOG_TRACE("insert " << prefix);
+  m_enlargeThreshold = static_cast<size_t>(m_enlargeLoadFactor *
+                                          static_cast<double>(m_nBuckets));
 
-  size_t hashValue = name_tree::computeHash(prefix);
-  size_t loc = hashValue % m_nBuckets;
+  m_shrinkThreshold = static_cast<size_t>(m_shrinkLoadFactor *
+                                          static_cast<double>(m_nBuckets));
+}
 
-  NFD_LOG_TRACE("Name " << prefix << " hash value = " << hashValue << "  location = " << loc);
+shared_ptr<name_tree::Entry>
+NameTree::findPrefix(const Name& name, size_t prefixLen, size_t hashValue) const
+{
+  BOOST_ASSERT(prefixLen <= name.size());
 
-  // Check if this Name has been stored
-  name_tree::Node* node = m_buckets[loc];
-  name_tree::Node* nodePrev = node;  // initialize nodePrev to node
+  if (static_cast<bool>(m_openTable))
+    return m_openTable->find(name, prefixLen, hashValue);
 
-  for (node = m_buckets[loc]; node != 0; node = node->m_next)
+  for (name_tree::Node* node = m_buckets[hashValue % m_nBuckets]; node != 0; node = node->m_next)
     {
-      if (static_cast<bool>(node->m_entry))
+      const shared_ptr<name_tree::Entry>& entry = node->m_entry;
+      // comparing the length first rejects most hash collisions, and isPrefixOf()
+      // avoids making a copy of the prefix
+      if (static_cast<bool>(entry) &&
+          hashValue == entry->getHash() &&
+          prefixLen == entry->getPrefix().size() &&
+          entry->getPrefix().isPrefixOf(name))
         {
-          if (prefix == node->m_entry->m_prefix)
-            {
-              return std::make_pair(node->m_entry, false); // false: old entry
-            }
+          return entry;
         }
-      nodePrev = node;
     }
 
-  NFD_LOG_TRACE("Did not find " << prefix << ", need to insert it to the table");
+  return shared_ptr<name_tree::Entry>();
+}
+
+// insert() is a private function, and called by only lookup()
+shared_ptr<name_tree::Entry>
+NameTree::insert(const Name& name, size_t prefixLen, size_t hashValue,
+                 name_tree::Entry* parent)
+{
+  BOOST_ASSERT(!static_cast<bool>(findPrefix(name, prefixLen, hashValue)));
+
+  // this is the only place where the prefix is copied out of the looked up name
+  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(name.getPrefix(prefixLen)));
+  entry->setHash(hashValue);
 
-  // If no bucket is empty occupied, we need to create a new node, and it is
-  // linked from nodePrev
-  node = new name_tree::Node();
-  node->m_prev = nodePrev;
+  NFD_LOG_TRACE("insert " << entry->getPrefix() << " hash value = " << hashValue);
 
-  if (nodePrev == 0)
+  if (static_cast<bool>(m_openTable))
     {
-      m_buckets[loc] = node;
+      m_openTable->insert(entry);
     }
   else
     {
-      nodePrev->m_next = node;
+      size_t loc = hashValue % m_nBuckets;
+
+      // the new node is linked after the last node of the bucket
+      name_tree::Node* nodePrev = 0;
+      for (name_tree::Node* node = m_buckets[loc]; node != 0; node = node->m_next)
+        {
+          nodePrev = node;
+        }
+
+      name_tree::Node* node = new name_tree::Node();
+      node->m_prev = nodePrev;
+
+      if (nodePrev == 0)
+        {
+          m_buckets[loc] = node;
+        }
+      else
+        {
+          nodePrev->m_next = node;
+        }
+
+      node->m_entry = entry; // link the Entry to its Node
+      entry->m_node = node; // link the node to Entry. Used in eraseEntryIfEmpty.
     }
 
-  // Create a new Entry
-  shared_ptr<name_tree::Entry> entry(make_shared<name_tree::Entry>(prefix));
-  entry->setHash(hashValue);
-  node->m_entry = entry; // link the Entry to its Node
-  entry->m_node = node; // link the node to Entry. Used in eraseEntryIfEmpty.
+  m_nItems++; // Increase the counter
+  entry->m_parent = parent;
+  if (parent != nullptr)
+    {
+      parent->m_children.push_back(entry.get());
+    }
 
-  return std::make_pair(entry, true); // true: new entry
+  if (m_nItems > m_enlargeThreshold)
+    {
+      resize(m_enlargeFactor * m_nBuckets);
+    }
+
+  return entry;
 }
 
 // Name Prefix Lookup. Create Name Tree Entry if not found
@@ -206,35 +258,28 @@ NameTree::lookup(const Name& prefix)
 {
   NFD_LOG_TRACE("lookup " << prefix);
 
-  shared_ptr<name_tree::Entry> entry;
-  shared_ptr<name_tree::Entry> parent;
+  // All prefix hashes are computed in one pass over the name, so that neither the
+  // probes nor the insertions below need to build and rehash intermediate Names.
+  std::vector<size_t> hashValueSet = name_tree::computeHashSet(prefix);
 
-  for (size_t i = 0; i <= prefix.size(); i++)
+  // Find the longest prefix that already exists. In the common case the name itself
+  // is present, and lookup() costs a single probe.
+  shared_ptr<name_tree::Entry> entry;
+  size_t nExisting = prefix.size() + 1;
+  while (nExisting > 0)
     {
-      Name temp = prefix.getPrefix(i);
-
-      // insert() will create the entry if it does not exist.
-      std::pair<shared_ptr<name_tree::Entry>, bool> ret = insert(temp);
-      entry = ret.first;
-
-      if (ret.second == true)
-        {
-          m_nItems++; // Increase the counter
-          entry->m_parent = parent;
-
-          if (static_cast<bool>(parent))
-            {
-              parent->m_children.push_back(entry);
-            }
-        }
-
-      if (m_nItems > m_enlargeThreshold)
-        {
-          resize(m_enlargeFactor * m_nBuckets);
-        }
+      entry = findPrefix(prefix, nExisting - 1, hashValueSet[nExisting - 1]);
+      if (static_cast<bool>(entry))
+        break;
+      --nExisting;
+    }
 
-      parent = entry;
+  // Create the missing entries, each one a child of the previous one
+  for (size_t i = nExisting; i <= prefix.size(); i++)
+    {
+      entry = insert(prefix, i, hashValueSet[i], entry.get());
     }
+
   return entry;
 }
 
@@ -244,30 +289,7 @@ NameTree::findExactMatch(const Name& prefix) const
 {
   NFD_LOG_TRACE("findExactMatch " << prefix);
 
-  size_t hashValue = name_tree::computeHash(prefix);
-  size_t loc = hashValue % m_nBuckets;
-
-  NFD_LOG_TRACE("Name " << prefix << " hash value = " << hashValue <<
-                "  location = " << loc);
-
-  shared_ptr<name_tree::Entry> entry;
-  name_tree::Node* node = 0;
-
-  for (node = m_buckets[loc]; node != 0; node = node->m_next)
-    {
-      entry = node->m_entry;
-      if (static_cast<bool>(entry))
-        {
-          if (hashValue == entry->getHash() && prefix == entry->getPrefix())
-            {
-              return entry;
-            }
-        } // if entry
-    } // for node
-
-  // if not found, the default value of entry (null pointer) will be returned
-  entry.reset();
-  return entry;
+  return findPrefix(prefix, prefix.size(), name_tree::computeHash(prefix));
 }
 
 // Longest Prefix Match
@@ -276,52 +298,44 @@ NameTree::findLongestPrefixMatch(const Name& prefix, const name_tree::EntrySelec
 {
   NFD_LOG_TRACE("findLongestPrefixMatch " << prefix);
 
-  shared_ptr<name_tree::Entry> entry;
   std::vector<size_t> hashValueSet = name_tree::computeHashSet(prefix);
 
-  size_t hashValue = 0;
-  size_t loc = 0;
-
   for (int i = static_cast<int>(prefix.size()); i >= 0; i--)
     {
-      hashValue = hashValueSet[i];
-      loc = hashValue % m_nBuckets;
-
-      name_tree::Node* node = 0;
-      for (node = m_buckets[loc]; node != 0; node = node->m_next)
+      shared_ptr<name_tree::Entry> entry = findPrefix(prefix, i, hashValueSet[i]);
+      if (static_cast<bool>(entry) && entrySelector(*entry))
         {
-          entry = node->m_entry;
-          if (static_cast<bool>(entry))
-            {
-              // isPrefixOf() is used to avoid making a copy of the name
-              if (hashValue == entry->getHash() &&
-                  entry->getPrefix().isPrefixOf(prefix) &&
-                  entrySelector(*entry))
-                {
-                  return entry;
-                }
-            } // if entry
-        } // for node
+          return entry;
+        }
     }
 
-  // if not found, the default value of entry (null pointer) will be returned
-  entry.reset();
-  return entry;
+  return shared_ptr<name_tree::Entry>();
 }
 
 shared_ptr<name_tree::Entry>
 NameTree::findLongestPrefixMatch(shared_ptr<name_tree::Entry> entry,
                                  const name_tree::EntrySelector& entrySelector) const
 {
-  while (static_cast<bool>(entry))
+  for (name_tree::Entry* nte = entry.get(); nte != nullptr; nte = nte->getParent())
     {
-      if (entrySelector(*entry))
-        return entry;
-      entry = entry->getParent();
+      if (entrySelector(*nte))
+        return nte == entry.get() ? entry : nte->shared_from_this();
     }
   return shared_ptr<name_tree::Entry>();
 }
 
+const name_tree::Entry*
+NameTree::findLongestPrefixMatch(const name_tree::Entry& entry,
+                                 const name_tree::EntrySelector& entrySelector) const
+{
+  for (const name_tree::Entry* nte = &entry; nte != nullptr; nte = nte->getParent())
+    {
+      if (entrySelector(*nte))
+        return nte;
+    }
+  return nullptr;
+}
+
 // return {false: this entry is not empty, true: this entry is empty and erased}
 bool
 NameTree::eraseEntryIfEmpty(shared_ptr<name_tree::Entry> entry)
@@ -334,18 +348,18 @@ NameTree::eraseEntryIfEmpty(shared_ptr<name_tree::Entry> entry)
   if (entry->isEmpty())
     {
       // update child-related info in the parent
-      shared_ptr<name_tree::Entry> parent = entry->getParent();
+      name_tree::Entry* parent = entry->getParent();
 
-      if (static_cast<bool>(parent))
+      if (parent != nullptr)
         {
-          std::vector<shared_ptr<name_tree::Entry> >& parentChildrenList =
+          std::vector<name_tree::Entry*>& parentChildrenList =
             parent->getChildren();
 
           bool isFound = false;
           size_t size = parentChildrenList.size();
           for (size_t i = 0; i < size; i++)
             {
-              if (parentChildrenList[i] == entry)
+              if (parentChildrenList[i] == entry.get())
                 {
                   parentChildrenList[i] = parentChildrenList[size - 1];
                   parentChildrenList.pop_back();
@@ -357,35 +371,46 @@ NameTree::eraseEntryIfEmpty(shared_ptr<name_tree::Entry> entry)
           BOOST_VERIFY(isFound == true);
         }
 
-      // remove this Entry and its Name Tree Node
-      name_tree::Node* node = entry->m_node;
-      name_tree::Node* nodePrev = node->m_prev;
-
-      // configure the previous node
-      if (nodePrev != 0)
+      if (static_cast<bool>(m_openTable))
         {
-          // link the previous node to the next node
-          nodePrev->m_next = node->m_next;
+          m_openTable->erase(*entry);
         }
       else
         {
-          m_buckets[entry->getHash() % m_nBuckets] = node->m_next;
-        }
+          // remove this Entry and its Name Tree Node
+          name_tree::Node* node = entry->m_node;
+          name_tree::Node* nodePrev = node->m_prev;
 
-      // link the previous node with the next node (skip the erased one)
-      if (node->m_next != 0)
-        {
-          node->m_next->m_prev = nodePrev;
-          node->m_next = 0;
-        }
+          // configure the previous node
+          if (nodePrev != 0)
+            {
+              // link the previous node to the next node
+              nodePrev->m_next = node->m_next;
+            }
+          else
+            {
+              m_buckets[entry->getHash() % m_nBuckets] = node->m_next;
+            }
+
+          // link the previous node with the next node (skip the erased one)
+          if (node->m_next != 0)
+            {
+              node->m_next->m_prev = nodePrev;
+              node->m_next = 0;
+            }
+
+          BOOST_ASSERT(node->m_next == 0);
 
-      BOOST_ASSERT(node->m_next == 0);
+          delete node;
+        }
 
       m_nItems--;
-      delete node;
 
-      if (static_cast<bool>(parent))
-        eraseEntryIfEmpty(parent);
+      // the parent pointer would dangle once the parent is erased
+      entry->m_parent = nullptr;
+
+      if (parent != nullptr)
+        eraseEntryIfEmpty(parent->shared_from_this());
 
       size_t newNBuckets = static_cast<size_t>(m_shrinkFactor *
                                      static_cast<double>(m_nBuckets));
@@ -407,11 +432,23 @@ NameTree::fullEnumerate(const name_tree::EntrySelector& entrySelector) const
 {
   NFD_LOG_TRACE("fullEnumerate");
 
+  if (static_cast<bool>(m_openTable)) {
+    for (const name_tree::Entry* entry = m_openTable->getFirst();
+         entry != nullptr;
+         entry = m_openTable->getNext(*entry)) {
+      if (entrySelector(*entry)) {
+        const_iterator it(FULL_ENUMERATE_TYPE, *this, entry, entrySelector);
+        return {it, end()};
+      }
+    }
+    return {end(), end()};
+  }
+
   // find the first eligible entry
   for (size_t i = 0; i < m_nBuckets; i++) {
     for (name_tree::Node* node = m_buckets[i]; node != 0; node = node->m_next) {
       if (static_cast<bool>(node->m_entry) && entrySelector(*node->m_entry)) {
-        const_iterator it(FULL_ENUMERATE_TYPE, *this, node->m_entry, entrySelector);
+        const_iterator it(FULL_ENUMERATE_TYPE, *this, node->m_entry.get(), entrySelector);
         return {it, end()};
       }
     }
@@ -434,7 +471,7 @@ NameTree::partialEnumerate(const Name& prefix,
   std::pair<bool, bool>result = entrySubTreeSelector(*entry);
   const_iterator it(PARTIAL_ENUMERATE_TYPE,
                     *this,
-                    entry,
+                    entry.get(),
                     name_tree::AnyEntry(),
                     entrySubTreeSelector);
 
@@ -465,7 +502,7 @@ NameTree::findAllMatches(const Name& prefix,
   shared_ptr<name_tree::Entry> entry = findLongestPrefixMatch(prefix, entrySelector);
 
   if (static_cast<bool>(entry)) {
-    const_iterator begin(FIND_ALL_MATCHES_TYPE, *this, entry, entrySelector);
+    const_iterator begin(FIND_ALL_MATCHES_TYPE, *this, entry.get(), entrySelector);
     return {begin, end()};
   }
   // If none of the entry satisfies the requirements, then return the end() iterator.
@@ -478,6 +515,15 @@ NameTree::resize(size_t newNBuckets)
 {
   NFD_LOG_TRACE("resize");
 
+  if (static_cast<bool>(m_openTable))
+    {
+      // entries are migrated incrementally by subsequent insertions and erasures
+      m_openTable->resize(newNBuckets);
+      m_nBuckets = m_openTable->getNSlots();
+      updateThresholds();
+      return;
+    }
+
   name_tree::Node** newBuckets = new name_tree::Node*[newNBuckets];
   size_t count = 0;
 
@@ -524,10 +570,7 @@ NameTree::resize(size_t newNBuckets)
 
   m_nBuckets = newNBuckets;
 
-  m_enlargeThreshold = static_cast<size_t>(m_enlargeLoadFactor *
-                                              static_cast<double>(m_nBuckets));
-  m_shrinkThreshold = static_cast<size_t>(m_shrinkLoadFactor *
-                                              static_cast<double>(m_nBuckets));
+  updateThresholds();
 }
 
 // For debugging
@@ -536,48 +579,35 @@ NameTree::dump(std::ostream& output) const
 {
   NFD_LOG_TRACE("dump()");
 
-  name_tree::Node* node = 0;
-  shared_ptr<name_tree::Entry> entry;
-
   using std::endl;
 
-  for (size_t i = 0; i < m_nBuckets; i++)
+  // entries are enumerated in bucket order, and each is listed under its home bucket
+  for (const name_tree::Entry& entry : fullEnumerate())
     {
-      for (node = m_buckets[i]; node != 0; node = node->m_next)
-        {
-          entry = node->m_entry;
-
-          // if the Entry exist, dump its information
-          if (static_cast<bool>(entry))
-            {
-              output << "Bucket" << i << "\t" << entry->m_prefix.toUri() << endl;
-              output << "\t\tHash " << entry->m_hash << endl;
-
-              if (static_cast<bool>(entry->m_parent))
-                {
-                  output << "\t\tparent->" << entry->m_parent->m_prefix.toUri();
-                }
-              else
-                {
-                  output << "\t\tROOT";
-                }
-              output << endl;
+      output << "Bucket" << entry.m_hash % m_nBuckets << "\t" << entry.m_prefix.toUri() << endl;
+      output << "\t\tHash " << entry.m_hash << endl;
 
-              if (entry->m_children.size() != 0)
-                {
-                  output << "\t\tchildren = " << entry->m_children.size() << endl;
-
-                  for (size_t j = 0; j < entry->m_children.size(); j++)
-                    {
-                      output << "\t\t\tChild " << j << " " <<
-                        entry->m_children[j]->getPrefix() << endl;
-                    }
-                }
+      if (static_cast<bool>(entry.m_parent))
+        {
+          output << "\t\tparent->" << entry.m_parent->m_prefix.toUri();
+        }
+      else
+        {
+          output << "\t\tROOT";
+        }
+      output << endl;
 
-            } // if (static_cast<bool>(entry))
+      if (entry.m_children.size() != 0)
+        {
+          output << "\t\tchildren = " << entry.m_children.size() << endl;
 
-        } // for node
-    } // for int i
+          for (size_t j = 0; j < entry.m_children.size(); j++)
+            {
+              output << "\t\t\tChild " << j << " " <<
+                entry.m_children[j]->getPrefix() << endl;
+            }
+        }
+    }
 
   output << "Bucket count = " << m_nBuckets << endl;
   output << "Stored item = " << m_nItems << endl;
@@ -586,12 +616,14 @@ NameTree::dump(std::ostream& output) const
 
 NameTree::const_iterator::const_iterator()
   : m_nameTree(nullptr)
+  , m_entry(nullptr)
+  , m_subTreeRoot(nullptr)
 {
 }
 
 NameTree::const_iterator::const_iterator(NameTree::IteratorType type,
                             const NameTree& nameTree,
-                            shared_ptr<name_tree::Entry> entry,
+                            const name_tree::Entry* entry,
                             const name_tree::EntrySelector& entrySelector,
                             const name_tree::EntrySubTreeSelector& entrySubTreeSelector)
   : m_nameTree(&nameTree)
@@ -610,14 +642,32 @@ NameTree::const_iterator::operator++()
 {
   NFD_LOG_TRACE("const_iterator::operator++()");
 
-  BOOST_ASSERT(m_entry != m_nameTree->m_end);
+  BOOST_ASSERT(m_entry != nullptr);
+
+  if (m_type == FULL_ENUMERATE_TYPE && static_cast<bool>(m_nameTree->m_openTable))
+    {
+      const name_tree::OpenAddressingTable& openTable = *m_nameTree->m_openTable;
+      for (m_entry = openTable.getNext(*m_entry);
+           m_entry != nullptr;
+           m_entry = openTable.getNext(*m_entry))
+        {
+          if ((*m_entrySelector)(*m_entry))
+            {
+              return *this;
+            }
+        }
+
+      // Reach the end()
+      m_entry = nullptr;
+      return *this;
+    }
 
   if (m_type == FULL_ENUMERATE_TYPE) // fullEnumerate
     {
       // process the entries in the same bucket first
       while (m_entry->m_node->m_next != 0)
         {
-          m_entry = m_entry->m_node->m_next->m_entry;
+          m_entry = m_entry->m_node->m_next->m_entry.get();
           if ((*m_entrySelector)(*m_entry))
             {
               return *this;
@@ -634,7 +684,7 @@ NameTree::const_iterator::operator++()
           name_tree::Node* node = m_nameTree->m_buckets[newLocation];
           while (node != 0)
             {
-              m_entry = node->m_entry;
+              m_entry = node->m_entry.get();
               if ((*m_entrySelector)(*m_entry))
                 {
                   return *this;
@@ -644,7 +694,7 @@ NameTree::const_iterator::operator++()
         }
 
       // Reach the end()
-      m_entry = m_nameTree->m_end;
+      m_entry = nullptr;
       return *this;
     }
 
@@ -705,9 +755,9 @@ NameTree::const_iterator::operator++()
           else
             {
               // Should try to find its sibling
-              shared_ptr<name_tree::Entry> parent = m_entry->getParent();
+              const name_tree::Entry* parent = m_entry->getParent();
 
-              std::vector<shared_ptr<name_tree::Entry> >& parentChildrenList = parent->getChildren();
+              const std::vector<name_tree::Entry*>& parentChildrenList = parent->getChildren();
               bool isFound = false;
               size_t i = 0;
               for (i = 0; i < parentChildrenList.size(); i++)
@@ -744,7 +794,7 @@ NameTree::const_iterator::operator++()
             }
         }
 
-      m_entry = m_nameTree->m_end;
+      m_entry = nullptr;
       return *this;
     }
 
@@ -754,7 +804,7 @@ NameTree::const_iterator::operator++()
       // eligible Name Tree entry (i.e., has a PIT entry that can be satisfied
       // by the Data packet)
 
-      while (static_cast<bool>(m_entry->getParent()))
+      while (m_entry->getParent() != nullptr)
         {
           m_entry = m_entry->getParent();
           if ((*m_entrySelector)(*m_entry))
@@ -762,7 +812,7 @@ NameTree::const_iterator::operator++()
         }
 
       // Reach to the end (Root)
-      m_entry = m_nameTree->m_end;
+      m_entry = nullptr;
       return *this;
     }
 
@@ -28,6 +28,7 @@
 
 #include "common.hpp"
 #include "name-tree-entry.hpp"
+#include "name-tree-open-addressing-table.hpp"
 
 namespace nfd {
 namespace name_tree {
@@ -81,8 +82,22 @@ class NameTree : noncopyable
 public:
   class const_iterator;
 
+  /**
+   * \brief The layout of the Name Prefix Hash Table
+   */
+  enum HashTableLayout {
+    /** \brief Buckets of doubly linked Name Tree Nodes
+     */
+    CHAINED_LAYOUT,
+    /** \brief A flat array of slots holding cached hash values and Entry pointers,
+     *         with linear probing and incremental resize
+     *  \note Enumeration iterators are invalidated by lookup() and eraseEntryIfEmpty().
+     */
+    OPEN_ADDRESSING_LAYOUT
+  };
+
   explicit
-  NameTree(size_t nBuckets = 1024);
+  NameTree(size_t nBuckets = 1024, HashTableLayout layout = CHAINED_LAYOUT);
 
   ~NameTree();
 
@@ -101,6 +116,9 @@ public: // information
   size_t
   getNBuckets() const;
 
+  HashTableLayout
+  getHashTableLayout() const;
+
   /**
    * \brief Dump all the information stored in the Name Tree for debugging.
    */
@@ -110,13 +128,14 @@ public: // information
 public: // mutation
   /**
    * \brief Look for the Name Tree Entry that contains this name prefix.
-   * \details Starts from the shortest name prefix, and then increase the
-   * number of name components by one each time. All non-existing Name Tree
-   * Entries will be created.
+   * \details The hash values of all prefixes are computed in a single pass.
+   * Starts from the full name prefix, and then reduce the number of name
+   * components by one each time until an existing Entry is found. All
+   * non-existing Name Tree Entries below it will be created.
    * \param prefix The querying name prefix.
    * \return The pointer to the Name Tree Entry that contains this full name
    * prefix.
-   * \note Existing iterators are unaffected.
+   * \note Existing iterators are unaffected with CHAINED_LAYOUT.
    */
   shared_ptr<name_tree::Entry>
   lookup(const Name& prefix);
@@ -127,26 +146,35 @@ public: // mutation
    * \note This function must be called after a table entry is detached from Name Tree
    *       entry. The function deletes a Name Tree entry if nothing is attached to it and
    *       it has no children, then repeats the same process on its ancestors.
-   * \note Existing iterators, except those pointing to deleted entries, are unaffected.
+   * \note Existing iterators, except those pointing to deleted entries, are unaffected
+   *       with CHAINED_LAYOUT.
    */
   bool
   eraseEntryIfEmpty(shared_ptr<name_tree::Entry> entry);
 
 public: // shortcut access
-  /// get NameTree entry from attached FIB entry
-  shared_ptr<name_tree::Entry>
+  /** \brief get NameTree entry from attached FIB entry
+   *  \return a non-owning pointer, or nullptr if fibEntry is not attached
+   */
+  name_tree::Entry*
   get(const fib::Entry& fibEntry) const;
 
-  /// get NameTree entry from attached PIT entry
-  shared_ptr<name_tree::Entry>
+  /** \brief get NameTree entry from attached PIT entry
+   *  \return a non-owning pointer, or nullptr if pitEntry is not attached
+   */
+  name_tree::Entry*
   get(const pit::Entry& pitEntry) const;
 
-  /// get NameTree entry from attached Measurements entry
-  shared_ptr<name_tree::Entry>
+  /** \brief get NameTree entry from attached Measurements entry
+   *  \return a non-owning pointer, or nullptr if measurementsEntry is not attached
+   */
+  name_tree::Entry*
   get(const measurements::Entry& measurementsEntry) const;
 
-  /// get NameTree entry from attached StrategyChoice entry
-  shared_ptr<name_tree::Entry>
+  /** \brief get NameTree entry from attached StrategyChoice entry
+   *  \return a non-owning pointer, or nullptr if strategyChoiceEntry is not attached
+   */
+  name_tree::Entry*
   get(const strategy_choice::Entry& strategyChoiceEntry) const;
 
 public: // matching
@@ -173,6 +201,16 @@ public: // matching
                          const name_tree::EntrySelector& entrySelector =
                          name_tree::AnyEntry()) const;
 
+  /**
+   * \brief Longest prefix matching among entry and its ancestors
+   * \details Walks up the parent pointers without touching any reference count.
+   * \return a non-owning pointer, or nullptr if no entry is accepted
+   */
+  const name_tree::Entry*
+  findLongestPrefixMatch(const name_tree::Entry& entry,
+                         const name_tree::EntrySelector& entrySelector =
+                         name_tree::AnyEntry()) const;
+
   /** \brief Enumerate all the name prefixes that satisfy the prefix and entrySelector
    *  \return an unspecified type that have .begin() and .end() methods
    *          and is usable with range-based for
@@ -257,7 +295,7 @@ public: // enumeration
 
     const_iterator(NameTree::IteratorType type,
       const NameTree& nameTree,
-      shared_ptr<name_tree::Entry> entry,
+      const name_tree::Entry* entry,
       const name_tree::EntrySelector& entrySelector = name_tree::AnyEntry(),
       const name_tree::EntrySubTreeSelector& entrySubTreeSelector = name_tree::AnyEntrySubTree());
 
@@ -266,7 +304,7 @@ public: // enumeration
     const name_tree::Entry&
     operator*() const;
 
-    shared_ptr<name_tree::Entry>
+    const name_tree::Entry*
     operator->() const;
 
     const_iterator
@@ -283,8 +321,8 @@ public: // enumeration
 
   private:
     const NameTree*                             m_nameTree;
-    shared_ptr<name_tree::Entry>                m_entry;
-    shared_ptr<name_tree::Entry>                m_subTreeRoot;
+    const name_tree::Entry*                     m_entry; // nullptr at end()
+    const name_tree::Entry*                     m_subTreeRoot;
     shared_ptr<name_tree::EntrySelector>        m_entrySelector;
     shared_ptr<name_tree::EntrySubTreeSelector> m_entrySubTreeSelector;
     NameTree::IteratorType                      m_type;
@@ -302,6 +340,12 @@ private:
   void
   resize(size_t newNBuckets);
 
+  /**
+   * \brief Compute the enlarge and shrink thresholds from m_nBuckets.
+   */
+  void
+  updateThresholds();
+
 private:
   size_t                        m_nItems;  // Number of items being stored
   size_t                        m_nBuckets; // Number of hash buckets
@@ -312,20 +356,30 @@ private:
   double                        m_shrinkLoadFactor;
   size_t                        m_shrinkThreshold;
   double                        m_shrinkFactor;
-  name_tree::Node**             m_buckets; // Name Tree Buckets in the NPHT
-  shared_ptr<name_tree::Entry>  m_end;
+  name_tree::Node**             m_buckets; // Name Tree Buckets in the NPHT, if chained
+  unique_ptr<name_tree::OpenAddressingTable> m_openTable; // the NPHT, if open addressing
   const_iterator                m_endIterator;
 
   /**
-   * \brief Create a Name Tree Entry if it does not exist, or return the existing
-   * Name Tree Entry address.
+   * \brief Find the Name Tree Entry of name.getPrefix(prefixLen) without
+   * copying the prefix.
+   * \param hashValue The hash value of the prefix, i.e.,
+   * computeHashSet(name)[prefixLen].
+   * \return a null shared_ptr if this prefix is not found
+   */
+  shared_ptr<name_tree::Entry>
+  findPrefix(const Name& name, size_t prefixLen, size_t hashValue) const;
+
+  /**
+   * \brief Create the Name Tree Entry of name.getPrefix(prefixLen) as a child
+   * of parent.
    * \details Called by lookup() only.
-   * \return The first item is the Name Tree Entry address, the second item is
-   * a bool value indicates whether this is an old entry (false) or a new
-   * entry (true).
+   * \pre The prefix does not exist in the Name Tree.
+   * \return The new Name Tree Entry address.
    */
-  std::pair<shared_ptr<name_tree::Entry>, bool>
-  insert(const Name& prefix);
+  shared_ptr<name_tree::Entry>
+  insert(const Name& name, size_t prefixLen, size_t hashValue,
+         name_tree::Entry* parent);
 };
 
 inline NameTree::const_iterator::~const_iterator()
@@ -344,25 +398,31 @@ NameTree::getNBuckets() const
   return m_nBuckets;
 }
 
-inline shared_ptr<name_tree::Entry>
+inline NameTree::HashTableLayout
+NameTree::getHashTableLayout() const
+{
+  return static_cast<bool>(m_openTable) ? OPEN_ADDRESSING_LAYOUT : CHAINED_LAYOUT;
+}
+
+inline name_tree::Entry*
 NameTree::get(const fib::Entry& fibEntry) const
 {
   return fibEntry.m_nameTreeEntry;
 }
 
-inline shared_ptr<name_tree::Entry>
+inline name_tree::Entry*
 NameTree::get(const pit::Entry& pitEntry) const
 {
   return pitEntry.m_nameTreeEntry;
 }
 
-inline shared_ptr<name_tree::Entry>
+inline name_tree::Entry*
 NameTree::get(const measurements::Entry& measurementsEntry) const
 {
   return measurementsEntry.m_nameTreeEntry;
 }
 
-inline shared_ptr<name_tree::Entry>
+inline name_tree::Entry*
 NameTree::get(const strategy_choice::Entry& strategyChoiceEntry) const
 {
   return strategyChoiceEntry.m_nameTreeEntry;
@@ -386,7 +446,7 @@ NameTree::const_iterator::operator*() const
   return *m_entry;
 }
 
-inline shared_ptr<name_tree::Entry>
+inline const name_tree::Entry*
 NameTree::const_iterator::operator->() const
 {
   return m_entry;
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-entry-pool.hpp"
+#include "sit-entry.hpp"
+
+namespace nfd {
+namespace pit {
+
+/** \brief alignment of every block, suitable for any fundamental type
+ */
+static const size_t BLOCK_ALIGNMENT = 16;
+
+/** \brief number of blocks in the first chunk; each following chunk doubles it
+ */
+static const size_t INITIAL_BLOCKS_PER_CHUNK = 64;
+
+/** \brief upper bound of number of blocks in one chunk
+ */
+static const size_t MAX_BLOCKS_PER_CHUNK = 65536;
+
+BlockPool::BlockPool()
+  : m_blockSize(0)
+  , m_freeList(nullptr)
+  , m_chunkCursor(nullptr)
+  , m_chunkEnd(nullptr)
+  , m_nBlocksPerChunk(INITIAL_BLOCKS_PER_CHUNK)
+  , m_nInUse(0)
+  , m_nPeakInUse(0)
+  , m_capacity(0)
+  , m_nReused(0)
+{
+}
+
+BlockPool::~BlockPool()
+{
+  BOOST_ASSERT(m_nInUse == 0);
+
+  for (void* chunk : m_chunks) {
+    ::operator delete(chunk);
+  }
+}
+
+void*
+BlockPool::allocate(size_t size)
+{
+  if (m_blockSize == 0) {
+    m_blockSize = std::max(size, sizeof(FreeBlock));
+    m_blockSize = (m_blockSize + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+  }
+  else if (size > m_blockSize) {
+    return ::operator new(size);
+  }
+
+  void* block = nullptr;
+  if (m_freeList != nullptr) {
+    block = m_freeList;
+    m_freeList = m_freeList->next;
+    ++m_nReused;
+  }
+  else {
+    if (m_chunkCursor == m_chunkEnd) {
+      this->addChunk();
+    }
+    block = m_chunkCursor;
+    m_chunkCursor += m_blockSize;
+  }
+
+  ++m_nInUse;
+  m_nPeakInUse = std::max(m_nPeakInUse, m_nInUse);
+  return block;
+}
+
+void
+BlockPool::deallocate(void* block, size_t size)
+{
+  if (size > m_blockSize) {
+    ::operator delete(block);
+    return;
+  }
+
+  BOOST_ASSERT(m_nInUse > 0);
+  FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+  freeBlock->next = m_freeList;
+  m_freeList = freeBlock;
+  --m_nInUse;
+}
+
+void
+BlockPool::addChunk()
+{
+  void* chunk = ::operator new(m_nBlocksPerChunk * m_blockSize);
+  m_chunks.push_back(chunk);
+  m_chunkCursor = static_cast<char*>(chunk);
+  m_chunkEnd = m_chunkCursor + m_nBlocksPerChunk * m_blockSize;
+  m_capacity += m_nBlocksPerChunk;
+
+  m_nBlocksPerChunk = std::min(m_nBlocksPerChunk * 2, MAX_BLOCKS_PER_CHUNK);
+}
+
+EntryPool::EntryPool()
+  : m_entries(make_shared<BlockPool>())
+  , m_sitEntries(make_shared<BlockPool>())
+{
+}
+
+shared_ptr<Entry>
+EntryPool::makeEntry(const Interest& interest) const
+{
+  return std::allocate_shared<Entry>(PoolAllocator<Entry>(m_entries), interest);
+}
+
+shared_ptr<SitEntry>
+EntryPool::makeSitEntry(const Interest& interest) const
+{
+  return std::allocate_shared<SitEntry>(PoolAllocator<SitEntry>(m_sitEntries), interest);
+}
+
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,285 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_ENTRY_POOL_HPP
+#define NFD_DAEMON_TABLE_PIT_ENTRY_POOL_HPP
+
+#include "common.hpp"
+
+#include <limits>
+
+namespace nfd {
+namespace pit {
+
+class Entry;
+class SitEntry;
+
+/** \brief a pool of fixed-size memory blocks
+ *
+ *  Blocks are carved out of chunks that grow geometrically, and a deallocated block is
+ *  kept on a free list to be reused by the next allocation. Chunks are released only
+ *  when the pool is destructed.
+ *
+ *  The block size is fixed by the first allocation. A later request larger than the
+ *  block size is served by the global operator new, so that the pool is safe to use
+ *  with allocators that rebind to an implementation-defined node type.
+ */
+class BlockPool : noncopyable
+{
+public:
+  BlockPool();
+
+  ~BlockPool();
+
+  void*
+  allocate(size_t size);
+
+  void
+  deallocate(void* block, size_t size);
+
+public: // occupancy counters
+  /** \return size of each block in bytes, or 0 if nothing has been allocated yet
+   */
+  size_t
+  getBlockSize() const
+  {
+    return m_blockSize;
+  }
+
+  /** \return number of blocks currently allocated
+   */
+  size_t
+  getNInUse() const
+  {
+    return m_nInUse;
+  }
+
+  /** \return highest number of blocks allocated at the same time
+   */
+  size_t
+  getNPeakInUse() const
+  {
+    return m_nPeakInUse;
+  }
+
+  /** \return number of blocks owned by the pool, either allocated or available
+   */
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  /** \return number of allocations served from a previously deallocated block
+   */
+  size_t
+  getNReused() const
+  {
+    return m_nReused;
+  }
+
+private:
+  void
+  addChunk();
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  size_t m_blockSize;
+  FreeBlock* m_freeList;
+  std::vector<void*> m_chunks;
+  char* m_chunkCursor; ///< next block never handed out in the last chunk
+  char* m_chunkEnd;
+  size_t m_nBlocksPerChunk;
+
+  size_t m_nInUse;
+  size_t m_nPeakInUse;
+  size_t m_capacity;
+  size_t m_nReused;
+};
+
+/** \brief an allocator that draws single objects from a BlockPool
+ *
+ *  The allocator shares ownership of the pool, so that memory is returned to a live pool
+ *  even if an object outlives the owner of the pool.
+ *  A default-constructed allocator has no pool and uses the global operator new.
+ */
+template<typename T>
+class PoolAllocator
+{
+public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template<typename U>
+  struct rebind
+  {
+    typedef PoolAllocator<U> other;
+  };
+
+  PoolAllocator()
+  {
+  }
+
+  explicit
+  PoolAllocator(shared_ptr<BlockPool> pool)
+    : m_pool(std::move(pool))
+  {
+  }
+
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U>& other)
+    : m_pool(other.getPool())
+  {
+  }
+
+  const shared_ptr<BlockPool>&
+  getPool() const
+  {
+    return m_pool;
+  }
+
+  T*
+  allocate(size_t n, const void* hint = nullptr)
+  {
+    if (m_pool != nullptr && n == 1) {
+      return static_cast<T*>(m_pool->allocate(sizeof(T)));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n)
+  {
+    if (m_pool != nullptr && n == 1) {
+      m_pool->deallocate(p, sizeof(T));
+    }
+    else {
+      ::operator delete(p);
+    }
+  }
+
+  template<typename U, typename... Args>
+  void
+  construct(U* p, Args&&... args)
+  {
+    ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+  }
+
+  template<typename U>
+  void
+  destroy(U* p)
+  {
+    p->~U();
+  }
+
+  T*
+  address(T& x) const
+  {
+    return std::addressof(x);
+  }
+
+  const T*
+  address(const T& x) const
+  {
+    return std::addressof(x);
+  }
+
+  size_t
+  max_size() const
+  {
+    return std::numeric_limits<size_t>::max() / sizeof(T);
+  }
+
+private:
+  shared_ptr<BlockPool> m_pool;
+};
+
+template<typename T, typename U>
+inline bool
+operator==(const PoolAllocator<T>& a, const PoolAllocator<U>& b)
+{
+  return a.getPool() == b.getPool();
+}
+
+template<typename T, typename U>
+inline bool
+operator!=(const PoolAllocator<T>& a, const PoolAllocator<U>& b)
+{
+  return a.getPool() != b.getPool();
+}
+
+/** \brief memory pools for PIT and SIT entries
+ *
+ *  Each kind of entry has its own BlockPool, so that a freed slot is reused by an entry
+ *  of the same kind and the occupancy of each pool can be reported separately.
+ *  InRecords and OutRecords are stored inside the entry, and need no pool of their own.
+ *  An EntryPool is owned by the Forwarder and shared by its PIT and SIT.
+ */
+class EntryPool : noncopyable
+{
+public:
+  EntryPool();
+
+  /** \brief creates a PIT entry in the pool
+   */
+  shared_ptr<Entry>
+  makeEntry(const Interest& interest) const;
+
+  /** \brief creates a SIT entry in the pool
+   */
+  shared_ptr<SitEntry>
+  makeSitEntry(const Interest& interest) const;
+
+public: // occupancy counters
+  const BlockPool&
+  getEntryPool() const
+  {
+    return *m_entries;
+  }
+
+  const BlockPool&
+  getSitEntryPool() const
+  {
+    return *m_sitEntries;
+  }
+
+private:
+  shared_ptr<BlockPool> m_entries;
+  shared_ptr<BlockPool> m_sitEntries;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_ENTRY_POOL_HPP
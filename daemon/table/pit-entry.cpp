@@ -33,7 +33,12 @@ const Name Entry::LOCALHOST_NAME("ndn:/localhost");
 const Name Entry::LOCALHOP_NAME("ndn:/localhop");
 
 Entry::Entry(const Interest& interest)
-  : m_interest(interest.shared_from_this())
+  : m_unsatisfyTimer(*this, EntryTimer::UNSATISFY)
+  , m_stragglerTimer(*this, EntryTimer::STRAGGLER)
+  , m_isSatisfied(false)
+  , m_dataFreshnessPeriod(-1)
+  , m_interest(interest.shared_from_this())
+  , m_nameTreeEntry(nullptr)
 {
 }
 
@@ -130,11 +135,11 @@ Entry::findNonce(uint32_t nonce, const Face& face) const
 InRecordCollection::iterator
 Entry::insertOrUpdateInRecord(shared_ptr<Face> face, const Interest& interest)
 {
-  auto it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const InRecord& inRecord) { return inRecord.getFace() == face; });
+  auto it = m_inRecordIndex.find(m_inRecords, *face);
   if (it == m_inRecords.end()) {
-    m_inRecords.emplace_front(face);
-    it = m_inRecords.begin();
+    m_inRecords.emplace_back(face);
+    m_inRecordIndex.afterAppend(m_inRecords);
+    it = m_inRecords.end() - 1;
   }
 
   it->update(interest);
@@ -144,14 +149,14 @@ Entry::insertOrUpdateInRecord(shared_ptr<Face> face, const Interest& interest)
 InRecordCollection::const_iterator
 Entry::getInRecord(const Face& face) const
 {
-  return std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const InRecord& inRecord) { return inRecord.getFace().get() == &face; });
+  return m_inRecordIndex.find(m_inRecords, face);
 }
 
 void
 Entry::deleteInRecords()
 {
   m_inRecords.clear();
+  m_inRecordIndex.clear();
 }
 
 OutRecordCollection::iterator
@@ -160,8 +165,8 @@ Entry::insertOrUpdateOutRecord(shared_ptr<Face> face, const Interest& interest)
   auto it = std::find_if(m_outRecords.begin(), m_outRecords.end(),
     [&face] (const OutRecord& outRecord) { return outRecord.getFace() == face; });
   if (it == m_outRecords.end()) {
-    m_outRecords.emplace_front(face);
-    it = m_outRecords.begin();
+    m_outRecords.emplace_back(face);
+    it = m_outRecords.end() - 1;
   }
 
   it->update(interest);
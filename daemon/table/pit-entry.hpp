@@ -28,7 +28,9 @@
 
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
+#include "pit-face-record-index.hpp"
 #include "core/scheduler.hpp"
+#include "core/small-vector.hpp"
 
 namespace nfd {
 
@@ -41,12 +43,16 @@ class Entry;
 namespace pit {
 
 /** \brief represents an unordered collection of InRecords
+ *
+ *  Most PIT entries have one to three InRecords, which are stored inside the entry.
  */
-typedef std::list< InRecord>  InRecordCollection;
+typedef SmallVector<InRecord, 3> InRecordCollection;
 
 /** \brief represents an unordered collection of OutRecords
+ *
+ *  Most PIT entries have one or two OutRecords, which are stored inside the entry.
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef SmallVector<OutRecord, 2> OutRecordCollection;
 
 /** \brief indicates where duplicate Nonces are found
  */
@@ -62,9 +68,44 @@ enum DuplicateNonceWhere {
   DUPLICATE_NONCE_OUT_OTHER = (1 << 3)
 };
 
+class Entry;
+
+/** \brief a timer of a PIT entry, scheduled on the TimerWheel of the Forwarder
+ */
+class EntryTimer : public scheduler::WheelTimer
+{
+public:
+  enum Kind {
+    UNSATISFY,
+    STRAGGLER
+  };
+
+  EntryTimer(Entry& entry, Kind kind)
+    : m_entry(entry)
+    , m_kind(kind)
+  {
+  }
+
+  Entry&
+  getEntry() const
+  {
+    return m_entry;
+  }
+
+  Kind
+  getKind() const
+  {
+    return m_kind;
+  }
+
+private:
+  Entry& m_entry;
+  Kind m_kind;
+};
+
 /** \brief represents a PIT entry
  */
-class Entry : public StrategyInfoHost, noncopyable
+class Entry : public StrategyInfoHost, noncopyable, public enable_shared_from_this<Entry>
 {
 public:
   explicit
@@ -167,18 +208,23 @@ public: // OutRecord
   hasUnexpiredOutRecords() const;
 
 public:
-  scheduler::EventId m_unsatisfyTimer;
-  scheduler::EventId m_stragglerTimer;
+  EntryTimer m_unsatisfyTimer;
+  EntryTimer m_stragglerTimer;
+
+  /// arguments of onInterestFinalize when the straggler timer expires
+  bool m_isSatisfied;
+  time::milliseconds m_dataFreshnessPeriod;
 
 protected:
   shared_ptr<const Interest> m_interest;
   InRecordCollection m_inRecords;
+  FaceRecordIndex<InRecordCollection> m_inRecordIndex;
   OutRecordCollection m_outRecords;
 
   static const Name LOCALHOST_NAME;
   static const Name LOCALHOP_NAME;
 
-  shared_ptr<name_tree::Entry> m_nameTreeEntry;
+  name_tree::Entry* m_nameTreeEntry; // non-owning, the Name Tree Entry outlives this entry
 
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
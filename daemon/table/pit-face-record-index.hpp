@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_FACE_RECORD_INDEX_HPP
+#define NFD_DAEMON_TABLE_PIT_FACE_RECORD_INDEX_HPP
+
+#include "face/face.hpp"
+
+namespace nfd {
+namespace pit {
+
+/** \return number of records above which a FaceRecordIndex is built
+ */
+size_t
+getFaceRecordIndexThreshold();
+
+/** \brief sets number of records above which a FaceRecordIndex is built
+ *
+ *  This affects collections that grow past the threshold after this call.
+ */
+void
+setFaceRecordIndexThreshold(size_t threshold);
+
+/** \brief an index of face records by their face
+ *  \tparam Collection a contiguous collection of FaceRecords, such as InRecordCollection
+ *
+ *  While a collection has no more records than getFaceRecordIndexThreshold(), a lookup
+ *  scans the collection, which is the fastest for a few records. When the collection grows
+ *  past the threshold, the position of each record is indexed by its face.
+ *
+ *  Records are identified by Face rather than FaceId, because faces that have not been
+ *  added to the FaceTable share INVALID_FACEID.
+ *  The index relies on records being only appended, or erased all at once with clear(),
+ *  or erased in bulk followed by afterErase().
+ */
+template<typename Collection>
+class FaceRecordIndex
+{
+public:
+  /** \return whether positions are indexed
+   */
+  bool
+  isBuilt() const
+  {
+    return m_positions != nullptr;
+  }
+
+  typename Collection::iterator
+  find(Collection& records, const Face& face) const
+  {
+    return records.begin() + this->findPosition(records, face);
+  }
+
+  typename Collection::const_iterator
+  find(const Collection& records, const Face& face) const
+  {
+    return records.begin() + this->findPosition(records, face);
+  }
+
+  /** \brief updates the index after a record is appended to records
+   */
+  void
+  afterAppend(const Collection& records)
+  {
+    BOOST_ASSERT(!records.empty());
+
+    if (m_positions != nullptr) {
+      m_positions->emplace(records.back().getFace().get(), records.size() - 1);
+    }
+    else if (records.size() > getFaceRecordIndexThreshold()) {
+      this->build(records);
+    }
+  }
+
+  /** \brief rebuilds the index after some records are erased
+   */
+  void
+  afterErase(const Collection& records)
+  {
+    m_positions.reset();
+    if (records.size() > getFaceRecordIndexThreshold()) {
+      this->build(records);
+    }
+  }
+
+  /** \brief drops the index after all records are erased
+   */
+  void
+  clear()
+  {
+    m_positions.reset();
+  }
+
+private:
+  void
+  build(const Collection& records)
+  {
+    m_positions.reset(new std::unordered_map<const Face*, size_t>);
+    for (size_t i = 0; i < records.size(); ++i) {
+      m_positions->emplace(records[i].getFace().get(), i);
+    }
+  }
+
+  /** \return position of the record of face, or records.size() if it does not exist
+   */
+  size_t
+  findPosition(const Collection& records, const Face& face) const
+  {
+    if (m_positions != nullptr) {
+      auto it = m_positions->find(&face);
+      return it == m_positions->end() ? records.size() : it->second;
+    }
+
+    return std::find_if(records.begin(), records.end(),
+      [&face] (const typename Collection::value_type& record) {
+        return record.getFace().get() == &face;
+      }) - records.begin();
+  }
+
+private:
+  unique_ptr<std::unordered_map<const Face*, size_t>> m_positions;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_FACE_RECORD_INDEX_HPP
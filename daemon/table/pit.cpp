@@ -52,8 +52,9 @@ static_assert(std::is_default_constructible<Pit::const_iterator>::value,
 BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Pit::const_iterator>));
 #endif // HAVE_IS_DEFAULT_CONSTRUCTIBLE
 
-Pit::Pit(NameTree& nameTree)
+Pit::Pit(NameTree& nameTree, const pit::EntryPool* pool)
   : m_nameTree(nameTree)
+  , m_pool(pool)
   , m_nItems(0)
 {
 }
@@ -82,7 +83,8 @@ Pit::insert(const Interest& interest)
     return { *it, false };
   }
 
-  shared_ptr<pit::Entry> entry = make_shared<pit::Entry>(interest);
+  shared_ptr<pit::Entry> entry = m_pool == nullptr ? make_shared<pit::Entry>(interest) :
+                                                    m_pool->makeEntry(interest);
   nameTreeEntry->insertPitEntry(entry);
   m_nItems++;
   return { entry, true };
@@ -108,11 +110,11 @@ Pit::findAllDataMatches(const Data& data) const
 void
 Pit::erase(shared_ptr<pit::Entry> pitEntry)
 {
-  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(*pitEntry);
-  BOOST_ASSERT(static_cast<bool>(nameTreeEntry));
+  name_tree::Entry* nameTreeEntry = m_nameTree.get(*pitEntry);
+  BOOST_ASSERT(nameTreeEntry != nullptr);
 
   nameTreeEntry->erasePitEntry(pitEntry);
-  m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
+  m_nameTree.eraseEntryIfEmpty(nameTreeEntry->shared_from_this());
 
   --m_nItems;
 }
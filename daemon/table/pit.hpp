@@ -28,6 +28,7 @@
 
 #include "name-tree.hpp"
 #include "pit-entry.hpp"
+#include "pit-entry-pool.hpp"
 
 namespace nfd {
 namespace pit {
@@ -48,8 +49,11 @@ typedef std::vector<shared_ptr<pit::Entry>> DataMatchResult;
 class Pit : noncopyable
 {
 public:
+  /** \param pool if not null, entries are allocated from this pool,
+   *              which must outlive the Pit
+   */
   explicit
-  Pit(NameTree& nameTree);
+  Pit(NameTree& nameTree, const pit::EntryPool* pool = nullptr);
 
   ~Pit();
 
@@ -136,6 +140,7 @@ public: // enumeration
 
 protected:
   NameTree& m_nameTree;
+  const pit::EntryPool* m_pool;
   size_t m_nItems;
 };
 
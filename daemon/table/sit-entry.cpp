@@ -31,17 +31,19 @@ namespace pit {
 
 SitEntry::SitEntry(const Interest& interest)
   : Entry(interest)
+  , m_lastForwarded(time::steady_clock::TimePoint::min())
+  , m_leaseIndex(0)
 {
 }
 
 SitInRecordCollection::iterator
 SitEntry::insertOrUpdateInRecord(shared_ptr<Face> face, const Interest& interest)
 {
-  auto it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const InRecord& inRecord) { return inRecord.getFace() == face; });
+  auto it = m_inRecordIndex.find(m_inRecords, *face);
   if (it == m_inRecords.end()) {
-    m_inRecords.emplace_front(face);
-    it = m_inRecords.begin();
+    m_inRecords.emplace_back(face);
+    m_inRecordIndex.afterAppend(m_inRecords);
+    it = m_inRecords.end() - 1;
   }
 
   it->update(interest);
@@ -51,27 +53,42 @@ SitEntry::insertOrUpdateInRecord(shared_ptr<Face> face, const Interest& interest
 SitInRecordCollection::const_iterator
 SitEntry::getInRecord(const Face& face) const
 {
-  return std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const InRecord& inRecord) { return inRecord.getFace().get() == &face; });
+  return m_inRecordIndex.find(m_inRecords, face);
 }
 
 void
 SitEntry::forwardInterest(shared_ptr<const Face> face)
-{       
-  SitInRecordCollection::iterator it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const SitInRecord& inRecord) { return inRecord.getFace() == face; });
+{
+  auto it = m_inRecordIndex.find(m_inRecords, *face);
   if (it != m_inRecords.end()) {
     it->forward();
+    m_lastForwarded = std::max(m_lastForwarded, it->getLastForwarded());
+  }
+}
+
+template<typename Collection>
+static void
+eraseExpiredRecords(Collection& records, FaceRecordIndex<Collection>& index,
+                    const time::steady_clock::TimePoint& now)
+{
+  auto last = std::remove_if(records.begin(), records.end(),
+    [&now] (const typename Collection::value_type& record) { return record.getExpiry() <= now; });
+  if (last == records.end()) {
+    return;
+  }
+
+  for (size_t nErased = records.end() - last; nErased > 0; --nErased) {
+    records.pop_back();
   }
+  index.afterErase(records);
 }
 
-time::steady_clock::TimePoint
-SitEntry::getLastForwarded() const
+bool
+SitEntry::deleteExpiredInRecords(const time::steady_clock::TimePoint& now)
 {
-  auto m = std::max_element(m_inRecords.begin(), m_inRecords.end(),
-    [](const SitInRecord& a, const SitInRecord& b) { return a.getLastForwarded() < b.getLastForwarded(); }
-  );
-  return m->getLastForwarded();
+  eraseExpiredRecords(m_inRecords, m_inRecordIndex, now);
+  eraseExpiredRecords(Entry::m_inRecords, Entry::m_inRecordIndex, now);
+  return !Entry::m_inRecords.empty();
 }
 
 } // namespace pit
@@ -32,11 +32,13 @@
 
 namespace nfd {
 
+class Sit;
+
 namespace pit {
 
 /** \brief represents an unordered collection of InRecords
  */
-typedef std::list< SitInRecord>  SitInRecordCollection;
+typedef SmallVector<SitInRecord, 3> SitInRecordCollection;
 
 /** \brief represents a PIT entry
  */
@@ -48,7 +50,10 @@ public:
   
   void
   forwardInterest(shared_ptr<const Face> face);
-  
+
+  /** \return the latest time an InRecord was forwarded,
+   *          or TimePoint::min() if none has been forwarded
+   */
   time::steady_clock::TimePoint
   getLastForwarded() const;
 
@@ -67,13 +72,34 @@ public: // InRecord
 
   /** \brief get the InRecord for face
    *  \return an iterator to the InRecord, or .end if it does not exist
+   *  \note Lookup is indexed by face once the number of InRecords
+   *        exceeds getFaceRecordIndexThreshold().
    */
   SitInRecordCollection::const_iterator
   getInRecord(const Face& face) const;
 
+public: // lease
+  /** \brief erases InRecords whose lease has expired
+   *
+   *  The lease of a subscriber is the expiry of its InRecord, which is extended
+   *  by every subscription Interest from that subscriber.
+   *  Both the Entry InRecords and the SitInRecords are erased.
+   *  \return whether any subscriber remains
+   */
+  bool
+  deleteExpiredInRecords(const time::steady_clock::TimePoint& now);
+
 protected:
   SitInRecordCollection m_inRecords;
-  
+
+private:
+  FaceRecordIndex<SitInRecordCollection> m_inRecordIndex;
+  time::steady_clock::TimePoint m_lastForwarded;
+
+  /// position in Sit lease list
+  size_t m_leaseIndex;
+
+  friend class nfd::Sit;
 };
 
 inline const SitInRecordCollection&
@@ -82,6 +108,12 @@ SitEntry::getInRecords() const
   return m_inRecords;
 }
 
+inline time::steady_clock::TimePoint
+SitEntry::getLastForwarded() const
+{
+  return m_lastForwarded;
+}
+
 } // namespace pit
 } // namespace nfd
 
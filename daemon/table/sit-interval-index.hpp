@@ -0,0 +1,308 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_SIT_INTERVAL_INDEX_HPP
+#define NFD_DAEMON_TABLE_SIT_INTERVAL_INDEX_HPP
+
+#include "common.hpp"
+
+namespace nfd {
+namespace pit {
+
+/** \brief a closed interval of name components in canonical order
+ *
+ *  The empty component is the smallest component, so an interval starting
+ *  from name::Component() has no lower bound.
+ */
+struct ComponentInterval
+{
+  ComponentInterval()
+    : hasHigh(false)
+  {
+  }
+
+  ComponentInterval(const name::Component& low, const name::Component& high)
+    : low(low)
+    , high(high)
+    , hasHigh(true)
+  {
+  }
+
+  bool
+  contains(const name::Component& point) const
+  {
+    return low <= point && (!hasHigh || point <= high);
+  }
+
+  name::Component low;
+  name::Component high;
+  /// false if the interval has no upper bound
+  bool hasHigh;
+};
+
+/** \brief an index of values by intervals of name components, answering stabbing queries
+ *  \tparam T value type
+ *
+ *  Intervals are kept in a treap ordered by lower bound, where each node records
+ *  the interval with the largest upper bound in its subtree.
+ *  Insertion and erasure take expected O(log n) time, plus the number of intervals
+ *  sharing the lower bound of an erased interval.
+ *  A query skips every subtree whose intervals all end before, or all start after,
+ *  the queried component, so it visits O(log n) nodes in addition to the matching intervals.
+ */
+template<typename T>
+class IntervalIndex
+{
+public:
+  IntervalIndex()
+    : m_size(0)
+    , m_nInserted(0)
+  {
+  }
+
+  /** \return number of indexed intervals
+   */
+  size_t
+  size() const
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const
+  {
+    return m_size == 0;
+  }
+
+  void
+  insert(const ComponentInterval& interval, const T& value)
+  {
+    NodePtr node(new Node(interval, value, makePriority(++m_nInserted)));
+
+    NodePtr less, notLess;
+    split(std::move(m_root), interval.low, false, less, notLess);
+    m_root = merge(merge(std::move(less), std::move(node)), std::move(notLess));
+    ++m_size;
+  }
+
+  /** \brief erases every interval with the same lower bound as interval,
+   *         whose value satisfies pred
+   *  \return number of erased intervals
+   */
+  template<typename Predicate>
+  size_t
+  erase(const ComponentInterval& interval, const Predicate& pred)
+  {
+    NodePtr less, notLess, equal, greater;
+    split(std::move(m_root), interval.low, false, less, notLess);
+    split(std::move(notLess), interval.low, true, equal, greater);
+
+    // intervals sharing a lower bound are usually few, so they are rebuilt in order
+    std::vector<NodePtr> kept;
+    size_t nErased = 0;
+    collect(std::move(equal), kept, pred, nErased);
+    for (NodePtr& node : kept) {
+      equal = merge(std::move(equal), std::move(node));
+    }
+
+    m_root = merge(merge(std::move(less), std::move(equal)), std::move(greater));
+    m_size -= nErased;
+    return nErased;
+  }
+
+  /** \brief invokes f(value) for each interval containing point
+   *  \return number of intervals tested
+   *
+   *  A value indexed under several overlapping intervals is visited once per interval.
+   */
+  template<typename F>
+  size_t
+  visit(const name::Component& point, const F& f) const
+  {
+    return visitSubtree(m_root.get(), point, f);
+  }
+
+private:
+  struct Node;
+  typedef unique_ptr<Node> NodePtr;
+
+  struct Node
+  {
+    Node(const ComponentInterval& interval, const T& value, uint32_t priority)
+      : interval(interval)
+      , value(value)
+      , priority(priority)
+      , maxHigh(&this->interval)
+    {
+    }
+
+    ComponentInterval interval;
+    T value;
+    uint32_t priority;
+    /// interval with the largest upper bound in this subtree
+    const ComponentInterval* maxHigh;
+    NodePtr left;
+    NodePtr right;
+  };
+
+  /** \return whether the upper bound of a is smaller than the upper bound of b
+   */
+  static bool
+  isHighLess(const ComponentInterval& a, const ComponentInterval& b)
+  {
+    return a.hasHigh && (!b.hasHigh || a.high < b.high);
+  }
+
+  static void
+  update(Node& node)
+  {
+    node.maxHigh = &node.interval;
+    if (node.left != nullptr && isHighLess(*node.maxHigh, *node.left->maxHigh)) {
+      node.maxHigh = node.left->maxHigh;
+    }
+    if (node.right != nullptr && isHighLess(*node.maxHigh, *node.right->maxHigh)) {
+      node.maxHigh = node.right->maxHigh;
+    }
+  }
+
+  /** \brief splits tree into nodes whose lower bound is less than key, or not greater than key
+   *         if equalToLeft, and the other nodes
+   */
+  static void
+  split(NodePtr tree, const name::Component& key, bool equalToLeft, NodePtr& left, NodePtr& right)
+  {
+    if (tree == nullptr) {
+      left.reset();
+      right.reset();
+      return;
+    }
+
+    bool isLeft = equalToLeft ? !(key < tree->interval.low) : tree->interval.low < key;
+    if (isLeft) {
+      split(std::move(tree->right), key, equalToLeft, tree->right, right);
+      update(*tree);
+      left = std::move(tree);
+    }
+    else {
+      split(std::move(tree->left), key, equalToLeft, left, tree->left);
+      update(*tree);
+      right = std::move(tree);
+    }
+  }
+
+  /** \pre every lower bound in left is not greater than every lower bound in right
+   */
+  static NodePtr
+  merge(NodePtr left, NodePtr right)
+  {
+    if (left == nullptr) {
+      return right;
+    }
+    if (right == nullptr) {
+      return left;
+    }
+
+    if (left->priority > right->priority) {
+      left->right = merge(std::move(left->right), std::move(right));
+      update(*left);
+      return left;
+    }
+    right->left = merge(std::move(left), std::move(right->left));
+    update(*right);
+    return right;
+  }
+
+  /** \brief detaches the nodes of tree in order, keeping those whose value fails pred
+   */
+  template<typename Predicate>
+  static void
+  collect(NodePtr tree, std::vector<NodePtr>& kept, const Predicate& pred, size_t& nErased)
+  {
+    if (tree == nullptr) {
+      return;
+    }
+
+    collect(std::move(tree->left), kept, pred, nErased);
+    NodePtr right = std::move(tree->right);
+    if (pred(tree->value)) {
+      ++nErased;
+    }
+    else {
+      update(*tree);
+      kept.push_back(std::move(tree));
+    }
+    collect(std::move(right), kept, pred, nErased);
+  }
+
+  /** \brief derives a treap priority from the insertion sequence number
+   *
+   *  Priorities are pseudo-random without drawing from the global random number generator,
+   *  so that inserting subscriptions does not shift the random stream of a simulation.
+   */
+  static uint32_t
+  makePriority(uint64_t seq)
+  {
+    uint64_t x = seq * 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return static_cast<uint32_t>(x >> 32);
+  }
+
+  template<typename F>
+  static size_t
+  visitSubtree(const Node* node, const name::Component& point, const F& f)
+  {
+    if (node == nullptr) {
+      return 0;
+    }
+
+    if (node->maxHigh->hasHigh && node->maxHigh->high < point) {
+      // every interval in this subtree ends before point
+      return 0;
+    }
+
+    size_t nTested = visitSubtree(node->left.get(), point, f) + 1;
+    if (point < node->interval.low) {
+      // this interval and every interval in the right subtree start after point
+      return nTested;
+    }
+    if (node->interval.contains(point)) {
+      f(node->value);
+    }
+    return nTested + visitSubtree(node->right.get(), point, f);
+  }
+
+private:
+  NodePtr m_root;
+  size_t m_size;
+  /// number of insertions, which seeds the priority of the next node
+  uint64_t m_nInserted;
+};
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_SIT_INTERVAL_INDEX_HPP
@@ -0,0 +1,297 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sit-subscription-index.hpp"
+
+namespace nfd {
+namespace pit {
+
+SubscriptionMatcher::SubscriptionMatcher(const Interest& interest)
+  : m_minFullNameLength(0)
+  , m_maxFullNameLength(std::numeric_limits<size_t>::max())
+  , m_needsFullCheck(false)
+{
+  size_t interestNameLength = interest.getName().size();
+
+  // A Data reaching this matcher is under the Interest Name, so its full Name
+  // has at least interestNameLength + 1 components; MinSuffixComponents 0 and 1
+  // are always satisfied.
+  if (interest.getMinSuffixComponents() > 1) {
+    m_minFullNameLength = interestNameLength + interest.getMinSuffixComponents();
+  }
+  if (interest.getMaxSuffixComponents() >= 0) {
+    m_maxFullNameLength = interestNameLength + interest.getMaxSuffixComponents();
+  }
+
+  m_needsFullCheck = !interest.getExclude().empty() ||
+                     !interest.getPublisherPublicKeyLocator().empty();
+}
+
+bool
+SubscriptionMatcher::matches(const Interest& interest, const Data& data) const
+{
+  size_t fullNameLength = data.getName().size() + 1;
+  if (fullNameLength < m_minFullNameLength || fullNameLength > m_maxFullNameLength) {
+    return false;
+  }
+
+  if (m_needsFullCheck) {
+    return interest.matchesData(data);
+  }
+  return true;
+}
+
+std::vector<ComponentInterval>
+getAllowedIntervals(const Exclude& exclude)
+{
+  std::vector<ComponentInterval> intervals;
+  if (exclude.empty()) {
+    return intervals;
+  }
+
+  // Exclude is ordered by std::greater, so it is walked in reverse to visit elements
+  // in ascending order; each element excludes its component and, if marked ANY,
+  // every component up to the next element.
+  // The empty component is the smallest, so an ANY on it starts the exclusion from the beginning.
+  name::Component low;
+  bool isAllowed = true;
+  for (auto element = exclude.rbegin(); element != exclude.rend(); ++element) {
+    const name::Component& component = element->first;
+    if (isAllowed && !component.empty()) {
+      intervals.push_back(ComponentInterval(low, component));
+    }
+    low = component;
+    isAllowed = !element->second;
+  }
+  if (isAllowed) {
+    ComponentInterval last;
+    last.low = low;
+    intervals.push_back(last);
+  }
+
+  return intervals;
+}
+
+SubscriptionIndex::Subscription::Subscription(shared_ptr<SitEntry> sitEntry)
+  : entry(sitEntry)
+  , matcher(sitEntry->getInterest())
+{
+}
+
+SubscriptionIndex::SubscriptionIndex()
+  : m_nSubscriptions(0)
+  , m_nFullNameSubscriptions(0)
+{
+}
+
+void
+SubscriptionIndex::insert(const name_tree::Entry& nte, shared_ptr<SitEntry> sitEntry)
+{
+  BOOST_ASSERT(static_cast<bool>(sitEntry));
+
+  std::vector<PrefixBucket>& buckets = m_index[nte.getHash()];
+  auto bucket = std::find_if(buckets.begin(), buckets.end(),
+                             [&nte] (const PrefixBucket& b) { return b.nte == &nte; });
+  if (bucket == buckets.end()) {
+    buckets.push_back(PrefixBucket());
+    bucket = std::prev(buckets.end());
+    bucket->nte = &nte;
+  }
+
+  std::vector<ComponentInterval> intervals =
+    getAllowedIntervals(sitEntry->getInterest().getExclude());
+  // a subscription whose Exclude allows no component never matches,
+  // and is kept with the unindexed subscriptions
+  if (intervals.empty()) {
+    bucket->subscriptions.push_back(Subscription(sitEntry));
+  }
+  else {
+    Subscription subscription(sitEntry);
+    for (const ComponentInterval& interval : intervals) {
+      bucket->predicates.insert(interval, subscription);
+    }
+  }
+  ++m_nSubscriptions;
+  if (isFullNamePrefix(nte)) {
+    ++m_nFullNameSubscriptions;
+  }
+}
+
+void
+SubscriptionIndex::erase(const name_tree::Entry& nte, const shared_ptr<SitEntry>& sitEntry)
+{
+  Index::iterator it = m_index.find(nte.getHash());
+  BOOST_ASSERT(it != m_index.end());
+
+  std::vector<PrefixBucket>& buckets = it->second;
+  auto bucket = std::find_if(buckets.begin(), buckets.end(),
+                             [&nte] (const PrefixBucket& b) { return b.nte == &nte; });
+  BOOST_ASSERT(bucket != buckets.end());
+
+  auto isEntry = [&sitEntry] (const Subscription& s) { return s.entry == sitEntry; };
+  std::vector<Subscription>& subscriptions = bucket->subscriptions;
+  auto sub = std::find_if(subscriptions.begin(), subscriptions.end(), isEntry);
+  if (sub != subscriptions.end()) {
+    *sub = subscriptions.back();
+    subscriptions.pop_back();
+  }
+  else {
+    // the intervals are recomputed from the Exclude the subscription was indexed with
+    for (const ComponentInterval& interval :
+         getAllowedIntervals(sitEntry->getInterest().getExclude())) {
+      bucket->predicates.erase(interval, isEntry);
+    }
+  }
+  --m_nSubscriptions;
+  if (isFullNamePrefix(nte)) {
+    --m_nFullNameSubscriptions;
+  }
+
+  if (bucket->empty()) {
+    if (bucket != std::prev(buckets.end())) {
+      *bucket = std::move(buckets.back());
+    }
+    buckets.pop_back();
+    if (buckets.empty()) {
+      m_index.erase(it);
+    }
+  }
+}
+
+void
+SubscriptionIndex::findAllDataMatches(const Data& data,
+                                      std::vector<shared_ptr<SitEntry>>& matches) const
+{
+  if (m_index.empty()) {
+    return;
+  }
+
+  findFullNameMatches(data, matches);
+
+  const Name& dataName = data.getName();
+  std::vector<size_t> hashValueSet = name_tree::computeHashSet(dataName);
+
+  // visit prefixes from longest to shortest, same as NameTree::findAllMatches
+  for (size_t i = hashValueSet.size(); i-- > 0;) {
+    Index::const_iterator it = m_index.find(hashValueSet[i]);
+    if (it == m_index.end()) {
+      continue;
+    }
+
+    for (const PrefixBucket& bucket : it->second) {
+      const Name& prefix = bucket.nte->getPrefix();
+      // NameTree hash is order-insensitive, so a collision is possible
+      if (prefix.size() != i || !prefix.isPrefixOf(dataName)) {
+        continue;
+      }
+
+      matchBucket(bucket, data, matches);
+    }
+  }
+}
+
+size_t
+SubscriptionIndex::findDataMatches(const name_tree::Entry& nte, const Data& data,
+                                   std::vector<shared_ptr<SitEntry>>& matches) const
+{
+  Index::const_iterator it = m_index.find(nte.getHash());
+  if (it == m_index.end()) {
+    return 0;
+  }
+
+  for (const PrefixBucket& bucket : it->second) {
+    if (bucket.nte == &nte) {
+      return matchBucket(bucket, data, matches);
+    }
+  }
+  return 0;
+}
+
+size_t
+SubscriptionIndex::findFullNameMatches(const Data& data,
+                                       std::vector<shared_ptr<SitEntry>>& matches) const
+{
+  // computing the full name needs the wire encoding and a SHA-256 digest,
+  // so it is skipped unless such a subscription exists
+  if (m_nFullNameSubscriptions == 0) {
+    return 0;
+  }
+
+  const Name& fullName = data.getFullName();
+  Index::const_iterator it = m_index.find(name_tree::computeHash(fullName));
+  if (it == m_index.end()) {
+    return 0;
+  }
+
+  size_t nTested = 0;
+  for (const PrefixBucket& bucket : it->second) {
+    if (bucket.nte->getPrefix() == fullName) {
+      nTested += matchBucket(bucket, data, matches);
+    }
+  }
+  return nTested;
+}
+
+bool
+SubscriptionIndex::isFullNamePrefix(const name_tree::Entry& nte)
+{
+  const Name& prefix = nte.getPrefix();
+  return !prefix.empty() && prefix.get(-1).isImplicitSha256Digest();
+}
+
+size_t
+SubscriptionIndex::matchBucket(const PrefixBucket& bucket, const Data& data,
+                               std::vector<shared_ptr<SitEntry>>& matches)
+{
+  for (const Subscription& sub : bucket.subscriptions) {
+    if (sub.matcher.matches(sub.entry->getInterest(), data)) {
+      matches.push_back(sub.entry);
+    }
+  }
+  size_t nTested = bucket.subscriptions.size();
+
+  // the predicate is on the component after the Interest Name,
+  // which is the implicit digest if the Data Name equals the Interest Name;
+  // an Interest Name equal to the full name leaves no component to select
+  size_t prefixLength = bucket.nte->getPrefix().size();
+  if (!bucket.predicates.empty() && prefixLength <= data.getName().size()) {
+    const Name& dataName = data.getName();
+    name::Component point = prefixLength < dataName.size() ?
+                            dataName.get(prefixLength) :
+                            data.getFullName().get(prefixLength);
+
+    nTested += bucket.predicates.visit(point,
+      [&data, &matches] (const Subscription& sub) {
+        if (sub.matcher.matches(sub.entry->getInterest(), data)) {
+          matches.push_back(sub.entry);
+        }
+      });
+  }
+
+  return nTested;
+}
+
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_SIT_SUBSCRIPTION_INDEX_HPP
+#define NFD_DAEMON_TABLE_SIT_SUBSCRIPTION_INDEX_HPP
+
+#include "name-tree.hpp"
+#include "sit-entry.hpp"
+#include "sit-interval-index.hpp"
+
+#include <limits>
+
+namespace nfd {
+namespace pit {
+
+/** \brief selectors of a subscription, compiled against the length of its Interest Name
+ *
+ *  A subscription is indexed under the NameTree entry of its Interest Name,
+ *  so any Data reaching its bucket is already known to be under that Name.
+ *  MinSuffixComponents and MaxSuffixComponents become a range of Data full Name lengths;
+ *  Interest::matchesData is only consulted when Exclude or PublisherPublicKeyLocator is present.
+ */
+class SubscriptionMatcher
+{
+public:
+  explicit
+  SubscriptionMatcher(const Interest& interest);
+
+  /** \brief determines whether data satisfies the subscription
+   *  \pre interest is the Interest this matcher is compiled from,
+   *       and interest.getName() is a prefix of data.getName()
+   */
+  bool
+  matches(const Interest& interest, const Data& data) const;
+
+  /** \return true if every Data under the Interest Name satisfies the subscription
+   */
+  bool
+  matchesAll() const;
+
+private:
+  size_t m_minFullNameLength;
+  size_t m_maxFullNameLength;
+  bool m_needsFullCheck;
+};
+
+/** \brief computes the components allowed by an Exclude selector
+ *  \return closed intervals covering every component not excluded by exclude,
+ *          or an empty collection if exclude is empty
+ *
+ *  Bounds are kept closed, so an interval may contain its excluded endpoints;
+ *  the intervals are a filter to be followed by Exclude::isExcluded.
+ */
+std::vector<ComponentInterval>
+getAllowedIntervals(const Exclude& exclude);
+
+/** \brief an index of SIT entries for Data matching
+ *
+ *  SIT entries are grouped into one PrefixBucket per NameTree entry,
+ *  and buckets are keyed by the NameTree entry hash.
+ *  A Data lookup computes the hash of each prefix of the Data Name once
+ *  and only visits prefixes that have subscriptions,
+ *  without enumerating NameTree entries that hold PIT, FIB or other table entries.
+ *
+ *  A subscription with an Exclude selector is a predicate on the component following
+ *  its Interest Name, such as a range of sequence numbers or timestamps, or a set of
+ *  excluded values. Such subscriptions are indexed by their allowed intervals,
+ *  so a Data only tests the subscriptions whose range contains its component.
+ */
+class SubscriptionIndex : noncopyable
+{
+public:
+  SubscriptionIndex();
+
+  /** \return number of indexed subscriptions
+   */
+  size_t
+  size() const;
+
+  /** \brief indexes sitEntry under nte
+   *  \pre sitEntry is attached to nte
+   */
+  void
+  insert(const name_tree::Entry& nte, shared_ptr<SitEntry> sitEntry);
+
+  /** \brief removes sitEntry from the index
+   *  \pre sitEntry has been indexed under nte
+   */
+  void
+  erase(const name_tree::Entry& nte, const shared_ptr<SitEntry>& sitEntry);
+
+  /** \brief appends all subscriptions matching data to matches
+   */
+  void
+  findAllDataMatches(const Data& data, std::vector<shared_ptr<SitEntry>>& matches) const;
+
+  /** \brief appends subscriptions attached to nte that match data to matches
+   *  \pre nte.getPrefix() is a prefix of data.getName()
+   *  \return number of subscriptions tested
+   */
+  size_t
+  findDataMatches(const name_tree::Entry& nte, const Data& data,
+                  std::vector<shared_ptr<SitEntry>>& matches) const;
+
+  /** \brief appends subscriptions whose Name is the full name of data to matches
+   *
+   *  A subscription Name ending with the implicit digest is one component longer
+   *  than the Data Name, so it is not found among the prefixes of the Data Name.
+   *  \return number of subscriptions tested
+   */
+  size_t
+  findFullNameMatches(const Data& data, std::vector<shared_ptr<SitEntry>>& matches) const;
+
+private:
+  struct Subscription
+  {
+    explicit
+    Subscription(shared_ptr<SitEntry> sitEntry);
+
+    shared_ptr<SitEntry> entry;
+    SubscriptionMatcher matcher;
+  };
+
+  /** \brief subscriptions attached to one NameTree entry
+   */
+  struct PrefixBucket
+  {
+    bool
+    empty() const
+    {
+      return subscriptions.empty() && predicates.empty();
+    }
+
+    const name_tree::Entry* nte;
+    /// subscriptions without a predicate on the next component
+    std::vector<Subscription> subscriptions;
+    /// subscriptions with an Exclude selector, indexed by allowed intervals
+    IntervalIndex<Subscription> predicates;
+  };
+
+  /** \brief buckets keyed by NameTree entry hash;
+   *         more than one bucket per key only on hash collision
+   */
+  typedef std::unordered_map<size_t, std::vector<PrefixBucket>> Index;
+
+  static size_t
+  matchBucket(const PrefixBucket& bucket, const Data& data,
+              std::vector<shared_ptr<SitEntry>>& matches);
+
+  static bool
+  isFullNamePrefix(const name_tree::Entry& nte);
+
+  Index m_index;
+  size_t m_nSubscriptions;
+  /// subscriptions whose Name ends with an implicit digest
+  size_t m_nFullNameSubscriptions;
+};
+
+inline bool
+SubscriptionMatcher::matchesAll() const
+{
+  return !m_needsFullCheck && m_minFullNameLength == 0 &&
+         m_maxFullNameLength == std::numeric_limits<size_t>::max();
+}
+
+inline size_t
+SubscriptionIndex::size() const
+{
+  return m_nSubscriptions;
+}
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_SIT_SUBSCRIPTION_INDEX_HPP
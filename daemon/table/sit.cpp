@@ -39,8 +39,15 @@ static_assert(std::is_move_constructible<SitDataMatchResult>::value,
               "SitDataMatchResult must be MoveConstructible");
 #endif // HAVE_IS_MOVE_CONSTRUCTIBLE
 
+CombinedDataMatchResult::CombinedDataMatchResult()
+  : nNameTreeEntries(0)
+  , nPitEntries(0)
+  , nSitEntries(0)
+{
 }
 
+} // namespace pit
+
 // http://en.cppreference.com/w/cpp/concept/ForwardIterator
 BOOST_CONCEPT_ASSERT((boost::ForwardIterator<Sit::const_iterator>));
 // boost::ForwardIterator follows SGI standard http://www.sgi.com/tech/stl/ForwardIterator.html,
@@ -52,8 +59,9 @@ static_assert(std::is_default_constructible<Sit::const_iterator>::value,
 BOOST_CONCEPT_ASSERT((boost::DefaultConstructible<Sit::const_iterator>));
 #endif // HAVE_IS_DEFAULT_CONSTRUCTIBLE
 
-Sit::Sit(NameTree& nameTree)
-  : Pit(nameTree)
+Sit::Sit(NameTree& nameTree, const pit::EntryPool* pool)
+  : Pit(nameTree, pool)
+  , m_sweepCursor(0)
 {
 }
 
@@ -81,41 +89,103 @@ Sit::insert(const Interest& interest)
     return { *it, false };
   }
 
-  shared_ptr<pit::SitEntry> entry = make_shared<pit::SitEntry>(interest);
+  shared_ptr<pit::SitEntry> entry = m_pool == nullptr ? make_shared<pit::SitEntry>(interest) :
+                                                       m_pool->makeSitEntry(interest);
   nameTreeEntry->insertSitEntry(entry);
+  m_subscriptionIndex.insert(*nameTreeEntry, entry);
+  entry->m_leaseIndex = m_leases.size();
+  m_leases.push_back(entry);
   m_nItems++;
   return { entry, true };
 }
 
 pit::SitDataMatchResult
 Sit::findAllDataMatches(const Data& data) const
+{
+  pit::SitDataMatchResult matches;
+  m_subscriptionIndex.findAllDataMatches(data, matches);
+  return matches;
+}
+
+pit::CombinedDataMatchResult
+Sit::findAllPitAndSitMatches(const Data& data) const
 {
   auto&& ntMatches = m_nameTree.findAllMatches(data.getName(),
-    [] (const name_tree::Entry& entry) { return entry.hasSitEntries(); });
+    [] (const name_tree::Entry& entry) {
+      return entry.hasPitEntries() || entry.hasSitEntries();
+    });
+
+  pit::CombinedDataMatchResult result;
+  result.nSitEntries += m_subscriptionIndex.findFullNameMatches(data, result.sitMatches);
 
-  pit::SitDataMatchResult matches;
   for (const name_tree::Entry& nte : ntMatches) {
-    for (const shared_ptr<pit::SitEntry>& pitEntry : nte.getSitEntries()) {
+    ++result.nNameTreeEntries;
+
+    for (const shared_ptr<pit::Entry>& pitEntry : nte.getPitEntries()) {
       if (pitEntry->getInterest().matchesData(data))
-        matches.emplace_back(pitEntry);
+        result.pitMatches.emplace_back(pitEntry);
+    }
+    result.nPitEntries += nte.getPitEntries().size();
+
+    if (nte.hasSitEntries()) {
+      result.nSitEntries += m_subscriptionIndex.findDataMatches(nte, data, result.sitMatches);
     }
   }
 
-  return matches;
+  return result;
 }
 
 void
 Sit::erase(shared_ptr<pit::SitEntry> pitEntry)
 {
-  shared_ptr<name_tree::Entry> nameTreeEntry = m_nameTree.get(*pitEntry);
-  BOOST_ASSERT(static_cast<bool>(nameTreeEntry));
+  name_tree::Entry* nameTreeEntry = m_nameTree.get(*pitEntry);
+  BOOST_ASSERT(nameTreeEntry != nullptr);
 
+  m_subscriptionIndex.erase(*nameTreeEntry, pitEntry);
   nameTreeEntry->eraseSitEntry(pitEntry);
-  m_nameTree.eraseEntryIfEmpty(nameTreeEntry);
+  m_nameTree.eraseEntryIfEmpty(nameTreeEntry->shared_from_this());
+
+  // the last entry takes the place of the erased entry in sweep order
+  size_t leaseIndex = pitEntry->m_leaseIndex;
+  BOOST_ASSERT(leaseIndex < m_leases.size() && m_leases[leaseIndex] == pitEntry);
+  if (leaseIndex != m_leases.size() - 1) {
+    m_leases[leaseIndex] = std::move(m_leases.back());
+    m_leases[leaseIndex]->m_leaseIndex = leaseIndex;
+  }
+  m_leases.pop_back();
 
   --m_nItems;
 }
 
+size_t
+Sit::sweep(size_t nEntries, const ExpireCallback& beforeErase)
+{
+  time::steady_clock::TimePoint now = time::steady_clock::now();
+  nEntries = std::min(nEntries, m_leases.size());
+
+  size_t nErased = 0;
+  for (size_t i = 0; i < nEntries && !m_leases.empty(); ++i) {
+    if (m_sweepCursor >= m_leases.size()) {
+      m_sweepCursor = 0;
+    }
+
+    shared_ptr<pit::SitEntry> entry = m_leases[m_sweepCursor];
+    if (entry->deleteExpiredInRecords(now)) {
+      ++m_sweepCursor;
+      continue;
+    }
+
+    if (beforeErase) {
+      beforeErase(entry);
+    }
+    // another entry moves into m_sweepCursor, and is visited next
+    this->erase(entry);
+    ++nErased;
+  }
+
+  return nErased;
+}
+
 Sit::const_iterator
 Sit::begin() const
 {
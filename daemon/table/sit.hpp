@@ -29,6 +29,7 @@
 #include "name-tree.hpp"
 #include "pit.hpp"
 #include "sit-entry.hpp"
+#include "sit-subscription-index.hpp"
 
 namespace nfd {
 namespace pit {
@@ -42,6 +43,23 @@ namespace pit {
  */
 typedef std::vector<shared_ptr<pit::SitEntry>> SitDataMatchResult;
 
+/** \brief PIT and SIT entries matching Data, found in a single NameTree walk
+ */
+struct CombinedDataMatchResult
+{
+  CombinedDataMatchResult();
+
+  DataMatchResult pitMatches;
+  SitDataMatchResult sitMatches;
+
+  /// number of NameTree entries visited
+  size_t nNameTreeEntries;
+  /// number of PIT entries tested against the Data
+  size_t nPitEntries;
+  /// number of SIT entries tested against the Data
+  size_t nSitEntries;
+};
+
 } // namespace pit
 
 /** \brief represents the Interest Table
@@ -49,8 +67,11 @@ typedef std::vector<shared_ptr<pit::SitEntry>> SitDataMatchResult;
 class Sit : public Pit
 {
 public:
+  /** \param pool if not null, entries are allocated from this pool,
+   *              which must outlive the Sit
+   */
   explicit
-  Sit(NameTree& nameTree);
+  Sit(NameTree& nameTree, const pit::EntryPool* pool = nullptr);
 
   ~Sit();
 
@@ -64,16 +85,48 @@ public:
 
   /** \brief performs a Data match
    *  \return an iterable of all PIT entries matching data
+   *  \note Matching is served by the subscription index,
+   *        which only visits prefixes of the Data Name that have SIT entries,
+   *        and only tests subscriptions with an Exclude selector whose allowed range
+   *        contains the next component of the Data Name.
    */
   pit::SitDataMatchResult
   findAllDataMatches(const Data& data) const;
 
+  /** \brief performs a Data match on both PIT and SIT
+   *
+   *  The ancestors of the Data Name are enumerated once in the NameTree shared with PIT,
+   *  and each visited NameTree entry contributes its matching PIT and SIT entries.
+   *  This is equivalent to pit.findAllDataMatches(data) followed by findAllDataMatches(data),
+   *  but computes the Name hashes and walks the parent chain only once.
+   */
+  pit::CombinedDataMatchResult
+  findAllPitAndSitMatches(const Data& data) const;
+
   /**
    *  \brief erases a PIT Entry
    */
   void
   erase(shared_ptr<pit::SitEntry> pitEntry);
 
+public: // lease
+  /** \brief invoked on a SIT entry whose subscribers have all expired, before it is erased
+   */
+  typedef function<void(const shared_ptr<pit::SitEntry>&)> ExpireCallback;
+
+  /** \brief incrementally erases expired subscriptions
+   *  \param nEntries maximum number of entries visited
+   *  \param beforeErase if not empty, invoked before an entry is erased
+   *  \return number of erased entries
+   *
+   *  Each visited entry loses the InRecords whose lease has expired,
+   *  and is erased if no InRecord remains.
+   *  Entries are visited round-robin, continuing from where the previous sweep stopped,
+   *  so that repeated calls cover the whole table with bounded work per call.
+   */
+  size_t
+  sweep(size_t nEntries, const ExpireCallback& beforeErase = ExpireCallback());
+
 public: // enumeration
   class const_iterator;
 
@@ -130,6 +183,12 @@ public: // enumeration
     size_t m_iPitEntry;
   };
 
+private:
+  pit::SubscriptionIndex m_subscriptionIndex;
+
+  /// all entries, in sweep order; SitEntry::m_leaseIndex is the position of each entry
+  std::vector<shared_ptr<pit::SitEntry>> m_leases;
+  size_t m_sweepCursor;
 };
 
 inline
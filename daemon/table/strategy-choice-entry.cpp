@@ -33,6 +33,7 @@ namespace strategy_choice {
 Entry::Entry(const Name& prefix)
   : m_prefix(prefix)
   , m_strategy(nullptr)
+  , m_nameTreeEntry(nullptr)
 {
 }
 
@@ -63,7 +63,7 @@ private:
   Name m_prefix;
   fw::Strategy* m_strategy;
 
-  shared_ptr<name_tree::Entry> m_nameTreeEntry;
+  name_tree::Entry* m_nameTreeEntry; // non-owning, the Name Tree Entry outlives this entry
   friend class nfd::NameTree;
   friend class nfd::name_tree::Entry;
 };
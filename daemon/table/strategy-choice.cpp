@@ -39,6 +39,7 @@ NFD_LOG_INIT("StrategyChoice");
 StrategyChoice::StrategyChoice(NameTree& nameTree, shared_ptr<Strategy> defaultStrategy)
   : m_nameTree(nameTree)
   , m_nItems(0)
+  , m_version(1)
 {
   this->setDefaultStrategy(defaultStrategy);
 }
@@ -118,6 +119,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(*strategy);
+  ++m_version;
   return true;
 }
 
@@ -144,6 +146,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(shared_ptr<Entry>());
   m_nameTree.eraseEntryIfEmpty(nte);
   --m_nItems;
+  ++m_version;
 }
 
 std::pair<bool, Name>
@@ -175,37 +178,40 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 }
 
 Strategy&
-StrategyChoice::findEffectiveStrategy(shared_ptr<name_tree::Entry> nte) const
+StrategyChoice::findEffectiveStrategy(const name_tree::Entry& nte) const
 {
-  shared_ptr<strategy_choice::Entry> entry = nte->getStrategyChoiceEntry();
-  if (static_cast<bool>(entry))
-    return entry->getStrategy();
+  if (nte.m_effectiveStrategyVersion == m_version) {
+    return *nte.m_effectiveStrategy;
+  }
 
-  nte = m_nameTree.findLongestPrefixMatch(nte,
+  const name_tree::Entry* match = m_nameTree.findLongestPrefixMatch(nte,
     [] (const name_tree::Entry& entry) {
       return static_cast<bool>(entry.getStrategyChoiceEntry());
     });
 
-  BOOST_ASSERT(static_cast<bool>(nte));
-  return nte->getStrategyChoiceEntry()->getStrategy();
+  BOOST_ASSERT(match != nullptr);
+  Strategy& strategy = match->getStrategyChoiceEntry()->getStrategy();
+  nte.m_effectiveStrategy = &strategy;
+  nte.m_effectiveStrategyVersion = m_version;
+  return strategy;
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(pitEntry);
+  const name_tree::Entry* nte = m_nameTree.get(pitEntry);
 
-  BOOST_ASSERT(static_cast<bool>(nte));
-  return this->findEffectiveStrategy(nte);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findEffectiveStrategy(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-  shared_ptr<name_tree::Entry> nte = m_nameTree.get(measurementsEntry);
+  const name_tree::Entry* nte = m_nameTree.get(measurementsEntry);
 
-  BOOST_ASSERT(static_cast<bool>(nte));
-  return this->findEffectiveStrategy(nte);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findEffectiveStrategy(*nte);
 }
 
 void
@@ -222,6 +228,7 @@ StrategyChoice::setDefaultStrategy(shared_ptr<Strategy> strategy)
   NFD_LOG_INFO("setDefaultStrategy " << strategy->getName());
 
   entry->setStrategy(*strategy);
+  ++m_version;
 }
 
 static inline void
@@ -258,7 +265,7 @@ StrategyChoice::changeStrategy(strategy_choice::Entry& entry,
 
   // reset StrategyInfo on a portion of NameTree,
   // where entry's effective strategy is covered by the changing StrategyChoice entry
-  const name_tree::Entry* rootNte = m_nameTree.get(entry).get();
+  const name_tree::Entry* rootNte = m_nameTree.get(entry);
   auto&& ntChanged = m_nameTree.partialEnumerate(entry.getPrefix(),
     [&rootNte] (const name_tree::Entry& nte) -> std::pair<bool, bool> {
       if (&nte == rootNte) {
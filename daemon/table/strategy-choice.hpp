@@ -93,7 +93,9 @@ public: // effective strategy
   fw::Strategy&
   findEffectiveStrategy(const Name& prefix) const;
 
-  /// get effective strategy for pitEntry
+  /** \brief get effective strategy for pitEntry
+   *  \note The result is cached on the NameTree entry of pitEntry until the table changes.
+   */
   fw::Strategy&
   findEffectiveStrategy(const pit::Entry& pitEntry) const;
 
@@ -159,12 +161,19 @@ private:
                  fw::Strategy& newStrategy);
 
   fw::Strategy&
-  findEffectiveStrategy(shared_ptr<name_tree::Entry> nte) const;
+  findEffectiveStrategy(const name_tree::Entry& nte) const;
 
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
 
+  /** \brief version of the table, incremented whenever an effective strategy may change
+   *
+   *  The effective strategy cached on a NameTree entry is valid only if it is tagged
+   *  with the current version, so that a change invalidates every cache at once.
+   */
+  uint64_t m_version;
+
   typedef std::map<Name, shared_ptr<fw::Strategy> > StrategyInstanceTable;
   StrategyInstanceTable m_strategyInstances;
 };
@@ -182,6 +182,47 @@ BOOST_AUTO_TEST_CASE(ThreadLocalScheduler)
   BOOST_CHECK(s1 != s2);
 }
 
+BOOST_AUTO_TEST_CASE(TimerWheel)
+{
+  scheduler::WheelTimer timers[5];
+  std::vector<std::pair<size_t, int64_t>> expired; // index, time in milliseconds
+  int nRescheduled = 0;
+  unique_ptr<scheduler::TimerWheel> wheel;
+
+  wheel.reset(new scheduler::TimerWheel([&] (scheduler::WheelTimer& timer) {
+    BOOST_CHECK(!timer.isScheduled());
+    size_t index = &timer - timers;
+    expired.emplace_back(index, ns3::Simulator::Now().GetMilliSeconds());
+    if (index == 4 && ++nRescheduled < 3) {
+      wheel->schedule(timer, time::milliseconds(2));
+    }
+  }));
+
+  wheel->schedule(timers[0], time::milliseconds(5));
+  wheel->schedule(timers[1], time::seconds(10)); // beyond the root wheel
+  wheel->schedule(timers[2], time::milliseconds(1));
+  wheel->schedule(timers[3], time::milliseconds(3));
+  wheel->schedule(timers[4], time::milliseconds(300));
+  BOOST_CHECK_EQUAL(wheel->size(), 5);
+
+  timers[3].cancel();
+  BOOST_CHECK(!timers[3].isScheduled());
+  wheel->schedule(timers[2], time::milliseconds(7)); // reschedule
+  BOOST_CHECK_EQUAL(wheel->size(), 4);
+
+  ns3::Simulator::Run();
+  ns3::Simulator::Destroy();
+
+  std::vector<std::pair<size_t, int64_t>> expected{
+    {0, 5}, {2, 7}, {4, 300}, {4, 302}, {4, 304}, {1, 10000}};
+  BOOST_REQUIRE_EQUAL(expired.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    BOOST_CHECK_EQUAL(expired[i].first, expected[i].first);
+    BOOST_CHECK_EQUAL(expired[i].second, expected[i].second);
+  }
+  BOOST_CHECK_EQUAL(wheel->size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/small-vector.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestSmallVector, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(InlineAndHeap)
+{
+  SmallVector<std::string, 2> vec;
+  BOOST_CHECK(vec.empty());
+  BOOST_CHECK(vec.isInline());
+  BOOST_CHECK_EQUAL(vec.capacity(), 2);
+
+  vec.emplace_back("a");
+  vec.push_back("b");
+  BOOST_CHECK_EQUAL(vec.size(), 2);
+  BOOST_CHECK(vec.isInline());
+
+  vec.emplace_back(3, 'c');
+  BOOST_CHECK_EQUAL(vec.size(), 3);
+  BOOST_CHECK(!vec.isInline());
+  BOOST_CHECK_GE(vec.capacity(), 3);
+  BOOST_CHECK_EQUAL(vec[0], "a");
+  BOOST_CHECK_EQUAL(vec[1], "b");
+  BOOST_CHECK_EQUAL(vec.back(), "ccc");
+
+  // the argument refers to an element that is moved during growth
+  vec.push_back(vec.front());
+  vec.push_back(vec.front());
+  BOOST_CHECK_EQUAL(vec.size(), 5);
+  BOOST_CHECK_EQUAL(vec[3], "a");
+  BOOST_CHECK_EQUAL(vec[4], "a");
+
+  SmallVector<std::string, 2> copy(vec);
+  BOOST_CHECK(std::equal(vec.begin(), vec.end(), copy.begin()));
+
+  vec.clear();
+  BOOST_CHECK(vec.empty());
+  BOOST_CHECK_EQUAL(copy.size(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  SmallVector<int, 4> vec;
+  for (int i = 0; i < 6; ++i) {
+    vec.push_back(i);
+  }
+
+  SmallVector<int, 4>::iterator it = vec.erase(vec.begin() + 1);
+  BOOST_CHECK_EQUAL(*it, 2);
+  BOOST_CHECK_EQUAL(vec.size(), 5);
+
+  it = vec.erase(vec.end() - 1);
+  BOOST_CHECK(it == vec.end());
+
+  std::vector<int> expected{0, 2, 3, 4};
+  BOOST_CHECK_EQUAL_COLLECTIONS(vec.begin(), vec.end(), expected.begin(), expected.end());
+
+  SmallVector<int, 4> assigned;
+  assigned.push_back(9);
+  assigned = vec;
+  BOOST_CHECK_EQUAL_COLLECTIONS(assigned.begin(), assigned.end(),
+                                expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Move)
+{
+  SmallVector<shared_ptr<int>, 2> spilled;
+  for (int i = 0; i < 3; ++i) {
+    spilled.push_back(make_shared<int>(i));
+  }
+  BOOST_REQUIRE(!spilled.isInline());
+  const shared_ptr<int>* buffer = spilled.begin();
+  shared_ptr<int> first = spilled.front();
+
+  // the heap buffer is taken, and elements are neither copied nor moved
+  SmallVector<shared_ptr<int>, 2> moved(std::move(spilled));
+  BOOST_CHECK(moved.begin() == buffer);
+  BOOST_CHECK_EQUAL(moved.size(), 3);
+  BOOST_CHECK_EQUAL(first.use_count(), 2);
+  BOOST_CHECK(spilled.empty());
+  BOOST_CHECK(spilled.isInline());
+  BOOST_CHECK_EQUAL(spilled.capacity(), 2);
+
+  // the moved-from container is usable
+  spilled.push_back(make_shared<int>(7));
+  BOOST_CHECK_EQUAL(*spilled.front(), 7);
+
+  // move assignment releases the previous elements and takes the heap buffer
+  spilled = std::move(moved);
+  BOOST_CHECK(spilled.begin() == buffer);
+  BOOST_CHECK_EQUAL(spilled.size(), 3);
+  BOOST_CHECK_EQUAL(first.use_count(), 2);
+  BOOST_CHECK(moved.empty());
+
+  // inline elements are moved one by one
+  SmallVector<shared_ptr<int>, 2> small;
+  small.push_back(first);
+  BOOST_CHECK_EQUAL(first.use_count(), 3);
+  SmallVector<shared_ptr<int>, 2> smallMoved(std::move(small));
+  BOOST_CHECK(smallMoved.isInline());
+  BOOST_CHECK(smallMoved.front() == first);
+  BOOST_CHECK_EQUAL(first.use_count(), 3);
+  BOOST_CHECK(small.empty());
+
+  BOOST_CHECK(std::is_nothrow_move_constructible<decltype(small)>::value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/cache-decision-lcd.hpp"
+#include "fw/cache-decision-fixed-probability.hpp"
+#include "fw/cache-decision-probcache.hpp"
+#include "fw/forwarder.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace fw {
+namespace tests {
+
+using namespace nfd::tests;
+
+class CacheDecisionFixture : public BaseFixture
+{
+protected:
+  CacheDecisionFixture()
+    : downstream(make_shared<DummyFace>())
+    , upstream(make_shared<DummyFace>())
+    , localUpstream(make_shared<DummyLocalFace>())
+  {
+    forwarder.addFace(downstream);
+    forwarder.addFace(upstream);
+    forwarder.addFace(localUpstream);
+  }
+
+  /** \brief lets Data from \p inFace satisfy a pending Interest from downstream
+   */
+  void
+  satisfy(const Name& name, Face& inFace)
+  {
+    shared_ptr<Interest> interest = makeInterest(name);
+    shared_ptr<pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(downstream, *interest);
+
+    shared_ptr<Data> data = makeData(name);
+    forwarder.onIncomingData(inFace, *data);
+  }
+
+protected:
+  Forwarder forwarder;
+  shared_ptr<DummyFace> downstream;
+  shared_ptr<DummyFace> upstream;
+  shared_ptr<DummyLocalFace> localUpstream;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FwCacheDecision, CacheDecisionFixture)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  BOOST_CHECK(forwarder.getCacheDecision() == nullptr);
+
+  satisfy("/A", *upstream);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().getNCsDeclined(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FixedProbability)
+{
+  forwarder.setCacheDecision(unique_ptr<CacheDecision>(new CacheDecisionFixedProbability(0.0)));
+  satisfy("/A", *upstream);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().getNCsDeclined(), 1);
+  // declined Data is still forwarded
+  BOOST_CHECK_EQUAL(downstream->m_sentDatas.size(), 1);
+
+  forwarder.setCacheDecision(unique_ptr<CacheDecision>(new CacheDecisionFixedProbability(1.0)));
+  satisfy("/B", *upstream);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().getNCsDeclined(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Lcd)
+{
+  forwarder.setCacheDecision(unique_ptr<CacheDecision>(new CacheDecisionLcd()));
+
+  // this node is the origin of Data from a local application
+  satisfy("/A", *localUpstream);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 0);
+
+  // Data without hop count tag has travelled one link from an upstream node
+  satisfy("/B", *upstream);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ProbCacheProbability)
+{
+  CacheDecisionProbCache probCache;
+  BOOST_CHECK_EQUAL(probCache.computeProbability(0, 0), 0.0);
+  BOOST_CHECK_EQUAL(probCache.computeProbability(0, 3), 0.0);
+  BOOST_CHECK_CLOSE(probCache.computeProbability(1, 3), 0.25, 0.001);
+  BOOST_CHECK_CLOSE(probCache.computeProbability(3, 1), 0.75, 0.001);
+  BOOST_CHECK_EQUAL(probCache.computeProbability(3, 0), 1.0);
+
+  CacheDecisionProbCache probCache2(2.0);
+  BOOST_CHECK_CLOSE(probCache2.computeProbability(1, 3), 0.5, 0.001);
+  BOOST_CHECK_EQUAL(probCache2.computeProbability(3, 1), 1.0);
+
+  forwarder.setCacheDecision(unique_ptr<CacheDecision>(new CacheDecisionProbCache()));
+  satisfy("/A", *localUpstream);
+  BOOST_CHECK_EQUAL(forwarder.getCs().size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace fw
+} // namespace nfd
@@ -135,10 +135,11 @@ public:
   }
 
 protected:
-  virtual void
-  dispatchToStrategy(shared_ptr<pit::Entry> pitEntry, function<void(fw::Strategy*)> f)
+  virtual fw::Strategy*
+  findDispatchStrategy(const pit::Entry& pitEntry)
   {
     ++m_dispatchToStrategy_count;
+    return nullptr;
   }
 
 public:
@@ -267,6 +268,41 @@ BOOST_AUTO_TEST_CASE(ScopeLocalhostOutgoing)
   BOOST_CHECK_EQUAL(face2->m_sentDatas.size(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(OutgoingDataFanOut)
+{
+  Forwarder forwarder;
+  shared_ptr<DummyLocalFace> face1 = make_shared<DummyLocalFace>();
+  shared_ptr<DummyFace>      face2 = make_shared<DummyFace>();
+  shared_ptr<DummyFace>      face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  // duplicates are sent once, inFace is excluded
+  Forwarder::DownstreamList downstreams;
+  downstreams.push_back(face2);
+  downstreams.push_back(face1);
+  downstreams.push_back(face3);
+  downstreams.push_back(face2);
+  downstreams.push_back(face1);
+  shared_ptr<Data> dataB = makeData("/B");
+  forwarder.onOutgoingDataFanOut(*dataB, *face3, downstreams);
+  BOOST_CHECK_EQUAL(face1->m_sentDatas.size(), 1);
+  BOOST_CHECK_EQUAL(face2->m_sentDatas.size(), 1);
+  BOOST_CHECK_EQUAL(face3->m_sentDatas.size(), 0);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().getNOutDatas(), 2);
+
+  // /localhost Data is sent only to local faces
+  downstreams.clear();
+  downstreams.push_back(face1);
+  downstreams.push_back(face2);
+  shared_ptr<Data> dataL = makeData("/localhost/B");
+  forwarder.onOutgoingDataFanOut(*dataL, *face3, downstreams);
+  BOOST_CHECK_EQUAL(face1->m_sentDatas.size(), 2);
+  BOOST_CHECK_EQUAL(face2->m_sentDatas.size(), 1);
+  BOOST_CHECK_EQUAL(forwarder.getCounters().getNOutDatas(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(ScopeLocalhopOutgoing)
 {
   Forwarder forwarder;
@@ -460,6 +496,158 @@ BOOST_FIXTURE_TEST_CASE(InterestLoopWithShortLifetime, UnitTestTimeFixture) // B
   // an Interest if its Name+Nonce has appeared any point in the past.
 }
 
+BOOST_FIXTURE_TEST_CASE(SubscriptionRefreshAggregation, UnitTestTimeFixture)
+{
+  Forwarder forwarder;
+  forwarder.setSubscriptionRefreshInterval(time::seconds(1));
+
+  shared_ptr<DummyFace> face1 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face2 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  Fib& fib = forwarder.getFib();
+  shared_ptr<fib::Entry> fibEntry = fib.insert(Name("ndn:/S")).first;
+  fibEntry->addNextHop(face3, 0);
+
+  const ForwarderCounters& counters = forwarder.getCounters();
+  auto receiveRefresh = [] (DummyFace& face, uint32_t nonce) {
+    shared_ptr<Interest> interest = makeInterest("ndn:/S");
+    interest->setSubscription(2);
+    interest->setNonce(nonce);
+    interest->setInterestLifetime(time::seconds(10));
+    face.receiveInterest(*interest);
+  };
+
+  // first subscription is forwarded
+  receiveRefresh(*face1, 8362);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesForwarded(), 1);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesSuppressed(), 0);
+
+  // refresh from another downstream within the interval is coalesced
+  this->advanceClocks(time::milliseconds(100), time::milliseconds(500));
+  receiveRefresh(*face2, 4025);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesForwarded(), 1);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesSuppressed(), 1);
+
+  // refresh after the interval is forwarded
+  this->advanceClocks(time::milliseconds(100), time::milliseconds(600));
+  receiveRefresh(*face1, 9311);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesForwarded(), 2);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesSuppressed(), 1);
+
+  // aggregation disabled
+  forwarder.setSubscriptionRefreshInterval(time::milliseconds::zero());
+  this->advanceClocks(time::milliseconds(10));
+  receiveRefresh(*face2, 2760);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesForwarded(), 3);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesSuppressed(), 1);
+  BOOST_CHECK_EQUAL(face3->m_sentInterests.size(), 3);
+
+  // a refresh dispatched to the strategy but suppressed by its retransmission
+  // suppression is not sent upstream, and is not counted as forwarded
+  receiveRefresh(*face1, 5702);
+  BOOST_CHECK_EQUAL(counters.getNSubscriptionRefreshesForwarded(), 3);
+  BOOST_CHECK_EQUAL(face3->m_sentInterests.size(), 3);
+
+  // only the refresh that was sent marks the subscription as forwarded
+  const pit::SitEntry& sitEntry = *forwarder.getSit().begin();
+  time::steady_clock::TimePoint lastSent = sitEntry.getLastForwarded();
+  this->advanceClocks(time::milliseconds(1));
+  receiveRefresh(*face1, 6128);
+  BOOST_CHECK_EQUAL(face3->m_sentInterests.size(), 3);
+  BOOST_CHECK(sitEntry.getLastForwarded() == lastSent);
+}
+
+BOOST_FIXTURE_TEST_CASE(SubscriptionShaping, UnitTestTimeFixture)
+{
+  Forwarder forwarder;
+
+  shared_ptr<DummyFace> face1 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face2 = make_shared<DummyFace>();
+  shared_ptr<DummyFace> face3 = make_shared<DummyFace>();
+  forwarder.addFace(face1);
+  forwarder.addFace(face2);
+  forwarder.addFace(face3);
+
+  Fib& fib = forwarder.getFib();
+  fib.insert(Name("ndn:/D")).first->addNextHop(face3, 0);
+  fib.insert(Name("ndn:/C")).first->addNextHop(face3, 0);
+
+  fw::SubscriptionShaper::Rule rule;
+  rule.rate = 10.0;
+  rule.burst = 2;
+  rule.mode = fw::SubscriptionShaper::MODE_DROP;
+  forwarder.getSubscriptionShaper().setRule("ndn:/D", rule);
+  rule.mode = fw::SubscriptionShaper::MODE_COALESCE;
+  forwarder.getSubscriptionShaper().setRule("ndn:/C", rule);
+
+  auto subscribe = [] (DummyFace& face, const Name& name) {
+    shared_ptr<Interest> interest = makeInterest(name);
+    interest->setSubscription(2);
+    interest->setInterestLifetime(time::seconds(10));
+    face.receiveInterest(*interest);
+  };
+  subscribe(*face1, "ndn:/D");
+  subscribe(*face2, "ndn:/C");
+
+  auto publish = [&face3] (const Name& prefix, uint64_t seq) {
+    shared_ptr<Data> data = makeData(Name(prefix).appendNumber(seq));
+    face3->receiveData(*data);
+  };
+
+  // drop: a burst of 5 passes 2
+  for (uint64_t seq = 1; seq <= 5; ++seq) {
+    publish("ndn:/D", seq);
+  }
+  BOOST_CHECK_EQUAL(face1->m_sentDatas.size(), 2);
+  BOOST_CHECK_EQUAL(face1->getCounters().getNShapedDatasDropped(), 3);
+  BOOST_CHECK_EQUAL(face1->getCounters().getNShapedDatasDelayed(), 0);
+
+  // coalesce: a burst of 5 passes 2, and the latest is sent when a token is available
+  for (uint64_t seq = 1; seq <= 5; ++seq) {
+    publish("ndn:/C", seq);
+  }
+  BOOST_CHECK_EQUAL(face2->m_sentDatas.size(), 2);
+  BOOST_CHECK_EQUAL(face2->getCounters().getNShapedDatasDelayed(), 1);
+  BOOST_CHECK_EQUAL(face2->getCounters().getNShapedDatasDropped(), 2);
+
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(150));
+  BOOST_REQUIRE_EQUAL(face2->m_sentDatas.size(), 3);
+  BOOST_CHECK_EQUAL(face2->m_sentDatas.back().getName(), Name("ndn:/C").appendNumber(5));
+
+  // tokens are refilled at the configured rate
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(200));
+  publish("ndn:/D", 6);
+  publish("ndn:/D", 7);
+  publish("ndn:/D", 8);
+  BOOST_CHECK_EQUAL(face1->m_sentDatas.size(), 4);
+  BOOST_CHECK_EQUAL(face1->getCounters().getNShapedDatasDropped(), 4);
+
+  // a subscriber of two matching topics gets each Data once, within one rate
+  subscribe(*face2, "ndn:/C/x");
+  this->advanceClocks(time::milliseconds(10), time::seconds(1));
+  face2->m_sentDatas.clear();
+  for (uint64_t seq = 1; seq <= 3; ++seq) {
+    publish("ndn:/C/x", seq);
+  }
+  BOOST_CHECK_EQUAL(face2->m_sentDatas.size(), 2);
+  this->advanceClocks(time::milliseconds(10), time::milliseconds(150));
+  BOOST_REQUIRE_EQUAL(face2->m_sentDatas.size(), 3);
+  BOOST_CHECK_EQUAL(face2->m_sentDatas[0].getName(), Name("ndn:/C/x").appendNumber(1));
+  BOOST_CHECK_EQUAL(face2->m_sentDatas[1].getName(), Name("ndn:/C/x").appendNumber(2));
+  BOOST_CHECK_EQUAL(face2->m_sentDatas[2].getName(), Name("ndn:/C/x").appendNumber(3));
+
+  // without rules, nothing is shaped
+  forwarder.getSubscriptionShaper().clearRules();
+  for (uint64_t seq = 9; seq <= 13; ++seq) {
+    publish("ndn:/D", seq);
+  }
+  BOOST_CHECK_EQUAL(face1->m_sentDatas.size(), 9);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -45,7 +45,10 @@ public:
     , m_fib(m_forwarder.getFib())
     , m_strategyChoice(m_forwarder.getStrategyChoice())
     , m_measurements(m_forwarder.getMeasurements())
-    , m_tablesConfig(m_cs, m_pit, m_fib, m_strategyChoice, m_measurements)
+    , m_subscriptionShaper(m_forwarder.getSubscriptionShaper())
+    , m_deadNonceList(m_forwarder.getDeadNonceList())
+    , m_tablesConfig(m_cs, m_pit, m_fib, m_strategyChoice, m_measurements,
+                     &m_subscriptionShaper, &m_deadNonceList)
   {
     m_tablesConfig.setConfigFile(m_config);
   }
@@ -77,6 +80,8 @@ protected:
   Fib& m_fib;
   StrategyChoice& m_strategyChoice;
   Measurements& m_measurements;
+  fw::SubscriptionShaper& m_subscriptionShaper;
+  DeadNonceList& m_deadNonceList;
 
   TablesConfigSection m_tablesConfig;
   ConfigFile m_config;
@@ -133,6 +138,91 @@ BOOST_AUTO_TEST_CASE(ValidCsMaxPackets)
   BOOST_CHECK_EQUAL(m_cs.getLimit(), 101);
 }
 
+BOOST_AUTO_TEST_CASE(ValidCsMaxBytes)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  cs_max_bytes 1048576\n"
+    "}\n";
+
+  BOOST_REQUIRE_NE(m_cs.getByteLimit(), 1048576);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_NE(m_cs.getByteLimit(), 1048576);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(m_cs.getByteLimit(), 1048576);
+
+  m_tablesConfig.ensureTablesAreConfigured();
+  BOOST_CHECK_EQUAL(m_cs.getByteLimit(), 1048576);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValueCsMaxBytes)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  cs_max_bytes 0\n"
+    "}\n";
+
+  const std::string expectedMsg =
+    "Invalid value for option \"cs_max_bytes\" in \"tables\" section";
+
+  BOOST_CHECK_EXCEPTION(runConfig(CONFIG, true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException,
+                             this, _1, expectedMsg));
+
+  BOOST_CHECK_EXCEPTION(runConfig(CONFIG, false),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException,
+                             this, _1, expectedMsg));
+}
+
+BOOST_AUTO_TEST_CASE(ValidCsPolicy)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  cs_policy tinylfu\n"
+    "}\n";
+
+  BOOST_REQUIRE_NE(m_cs.getPolicy()->getName(), "tinylfu");
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_NE(m_cs.getPolicy()->getName(), "tinylfu");
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(m_cs.getPolicy()->getName(), "tinylfu");
+
+  // the default policy is restored when the option is gone
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK_EQUAL(m_cs.getPolicy()->getName(), "fifo");
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValueCsPolicy)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  cs_policy invalid\n"
+    "}\n";
+
+  const std::string expectedMsg =
+    "Invalid value for option \"cs_policy\" in \"tables\" section";
+
+  BOOST_CHECK_EXCEPTION(runConfig(CONFIG, true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException,
+                             this, _1, expectedMsg));
+
+  BOOST_CHECK_EXCEPTION(runConfig(CONFIG, false),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException,
+                             this, _1, expectedMsg));
+}
+
 BOOST_AUTO_TEST_CASE(MissingValueCsMaxPackets)
 {
   const std::string CONFIG =
@@ -371,6 +461,165 @@ public:
   }
 };
 
+BOOST_AUTO_TEST_CASE(ValidSubscriptionShaping)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  subscription_shaping\n"
+    "  {\n"
+    "    /sensor\n"
+    "    {\n"
+    "      rate 10\n"
+    "    }\n"
+    "    /sensor/telemetry\n"
+    "    {\n"
+    "      rate 2.5\n"
+    "      burst 4\n"
+    "      mode coalesce\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_EQUAL(m_subscriptionShaper.size(), 0);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(m_subscriptionShaper.size(), 2);
+
+  const fw::SubscriptionShaper::Rule* sensor = m_subscriptionShaper.findRule("/sensor/power");
+  BOOST_REQUIRE(sensor != nullptr);
+  BOOST_CHECK_EQUAL(sensor->rate, 10.0);
+  BOOST_CHECK_EQUAL(sensor->burst, 1);
+  BOOST_CHECK_EQUAL(sensor->mode, fw::SubscriptionShaper::MODE_DROP);
+
+  const fw::SubscriptionShaper::Rule* telemetry =
+    m_subscriptionShaper.findRule("/sensor/telemetry/1");
+  BOOST_REQUIRE(telemetry != nullptr);
+  BOOST_CHECK_EQUAL(telemetry->rate, 2.5);
+  BOOST_CHECK_EQUAL(telemetry->burst, 4);
+  BOOST_CHECK_EQUAL(telemetry->mode, fw::SubscriptionShaper::MODE_COALESCE);
+
+  BOOST_CHECK(m_subscriptionShaper.findRule("/other") == nullptr);
+
+  // rules are removed when the section is gone
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK_EQUAL(m_subscriptionShaper.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidSubscriptionShaping)
+{
+  auto makeConfig = [] (const std::string& rule) -> std::string {
+    return "tables\n"
+           "{\n"
+           "  subscription_shaping\n"
+           "  {\n"
+           "    /sensor\n"
+           "    {\n" +
+           rule +
+           "    }\n"
+           "  }\n"
+           "}\n";
+  };
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("burst 4\n"), true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"rate\" of prefix \"/sensor\" in "
+                             "\"subscription_shaping\" section"));
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("rate 0\n"), true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"rate\" of prefix \"/sensor\" in "
+                             "\"subscription_shaping\" section"));
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("rate 1\nburst 0\n"), true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"burst\" of prefix \"/sensor\" in "
+                             "\"subscription_shaping\" section"));
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("rate 1\nmode fifo\n"), false),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"mode\" of prefix \"/sensor\" in "
+                             "\"subscription_shaping\" section"));
+  BOOST_CHECK_EQUAL(m_subscriptionShaper.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ValidDeadNonceFilter)
+{
+  const std::string CONFIG =
+    "tables\n"
+    "{\n"
+    "  dead_nonce_filter\n"
+    "  {\n"
+    "    false_positive_rate 0.0001\n"
+    "    expected_entries 1000\n"
+    "  }\n"
+    "}\n";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK(m_deadNonceList.getFilter() == nullptr);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  const DeadNonceFilter* filter = m_deadNonceList.getFilter();
+  BOOST_REQUIRE(filter != nullptr);
+  BOOST_CHECK_EQUAL(filter->getFalsePositiveRate(), 0.0001);
+  BOOST_CHECK_EQUAL(filter->getNExpectedEntries(), 1000);
+
+  // reloading an unchanged section keeps the filter and its entries
+  m_deadNonceList.add("ndn:/A", 0x53b4eaa8);
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK(m_deadNonceList.getFilter() == filter);
+  BOOST_CHECK_EQUAL(m_deadNonceList.has("ndn:/A", 0x53b4eaa8), true);
+
+  // options default to DeadNonceFilter::Options
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n  dead_nonce_filter\n  {\n  }\n}\n", false));
+  filter = m_deadNonceList.getFilter();
+  BOOST_REQUIRE(filter != nullptr);
+  const DeadNonceFilter::Options defaults;
+  BOOST_CHECK_EQUAL(filter->getFalsePositiveRate(), defaults.falsePositiveRate);
+  BOOST_CHECK_EQUAL(filter->getNExpectedEntries(), defaults.nExpectedEntries);
+
+  // the index is restored when the section is gone
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK(m_deadNonceList.getFilter() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidDeadNonceFilter)
+{
+  auto makeConfig = [] (const std::string& option) -> std::string {
+    return "tables\n"
+           "{\n"
+           "  dead_nonce_filter\n"
+           "  {\n" +
+           option +
+           "  }\n"
+           "}\n";
+  };
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("false_positive_rate 0\n"), true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"false_positive_rate\" in "
+                             "\"dead_nonce_filter\" section"));
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("false_positive_rate 1\n"), true),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"false_positive_rate\" in "
+                             "\"dead_nonce_filter\" section"));
+
+  BOOST_CHECK_EXCEPTION(runConfig(makeConfig("expected_entries 0\n"), false),
+                        ConfigFile::Error,
+                        bind(&TablesConfigSectionFixture::validateException, this, _1,
+                             "Invalid value for option \"expected_entries\" in "
+                             "\"dead_nonce_filter\" section"));
+  BOOST_CHECK(m_deadNonceList.getFilter() == nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(MissingTablesSection)
 {
   const std::string CONFIG =
@@ -85,6 +85,43 @@ BOOST_FIXTURE_TEST_CASE(EvictOneLRU, UnitTestTimeFixture)
           bind([] { BOOST_CHECK(true); }));
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictByBytes, UnitTestTimeFixture)
+{
+  Cs cs(100);
+  cs.setPolicy(unique_ptr<Policy>(new LruPolicy()));
+
+  std::vector<uint8_t> payload(1000, 0xBB);
+  auto makeLargeData = [&payload] (const Name& name) {
+    shared_ptr<Data> data = makeData(name);
+    data->setContent(payload.data(), payload.size());
+    data->wireEncode();
+    return data;
+  };
+
+  shared_ptr<Data> dataA = makeLargeData("ndn:/A");
+  size_t dataSize = dataA->wireEncode().size();
+  cs.setByteLimit(dataSize * 3);
+
+  cs.insert(*dataA);
+  cs.insert(*makeLargeData("ndn:/B"));
+  cs.insert(*makeLargeData("ndn:/C"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), dataSize * 3);
+
+  // use A
+  cs.find(Interest("ndn:/A"),
+          bind([] { BOOST_CHECK(true); }),
+          bind([] { BOOST_CHECK(false); }));
+
+  // evict B by bytes, although packet limit is not reached
+  cs.insert(*makeLargeData("ndn:/D"));
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), dataSize * 3);
+  cs.find(Interest("ndn:/B"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -141,6 +141,118 @@ BOOST_FIXTURE_TEST_CASE(Refresh, UnitTestTimeFixture)
           bind([] { BOOST_CHECK(true); }));
 }
 
+BOOST_FIXTURE_TEST_CASE(StaleOrder, UnitTestTimeFixture)
+{
+  Cs cs(3);
+  cs.setPolicy(unique_ptr<Policy>(new PriorityFifoPolicy()));
+
+  shared_ptr<Data> dataA = makeData("ndn:/A");
+  dataA->setFreshnessPeriod(time::milliseconds(50));
+  dataA->wireEncode();
+  cs.insert(*dataA);
+
+  shared_ptr<Data> dataB = makeData("ndn:/B");
+  dataB->setFreshnessPeriod(time::milliseconds(10));
+  dataB->wireEncode();
+  cs.insert(*dataB);
+
+  shared_ptr<Data> dataC = makeData("ndn:/C");
+  dataC->setFreshnessPeriod(time::milliseconds(99999));
+  dataC->wireEncode();
+  cs.insert(*dataC);
+
+  // staleness is determined at eviction time, without advancing through scheduled events
+  this->advanceClocks(time::milliseconds(60), 1);
+
+  // evict B, which became stale first
+  shared_ptr<Data> dataD = makeData("ndn:/D");
+  dataD->setFreshnessPeriod(time::milliseconds(99999));
+  dataD->wireEncode();
+  cs.insert(*dataD);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/B"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // evict A, stale
+  shared_ptr<Data> dataE = makeData("ndn:/E");
+  dataE->setFreshnessPeriod(time::milliseconds(99999));
+  dataE->wireEncode();
+  cs.insert(*dataE);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/A"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // evict C, fifo
+  shared_ptr<Data> dataF = makeData("ndn:/F");
+  dataF->setFreshnessPeriod(time::milliseconds(99999));
+  dataF->wireEncode();
+  cs.insert(*dataF);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  cs.find(Interest("ndn:/C"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+  cs.find(Interest("ndn:/D"),
+          bind([] { BOOST_CHECK(true); }),
+          bind([] { BOOST_CHECK(false); }));
+}
+
+BOOST_FIXTURE_TEST_CASE(EvictByBytes, UnitTestTimeFixture)
+{
+  Cs cs(100);
+  cs.setPolicy(unique_ptr<Policy>(new PriorityFifoPolicy()));
+
+  std::vector<uint8_t> payload(1000, 0xBB);
+  auto makeLargeData = [&payload] (const Name& name) {
+    shared_ptr<Data> data = makeData(name);
+    data->setFreshnessPeriod(time::milliseconds(99999));
+    data->setContent(payload.data(), payload.size());
+    data->wireEncode();
+    return data;
+  };
+
+  shared_ptr<Data> dataA = makeLargeData("ndn:/A");
+  size_t dataSize = dataA->wireEncode().size();
+  cs.setByteLimit(dataSize * 2 + dataSize / 2);
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), dataSize * 2 + dataSize / 2);
+
+  cs.insert(*dataA);
+  cs.insert(*makeLargeData("ndn:/B"));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), dataSize * 2);
+
+  // evict fifo by bytes, although packet limit is not reached
+  cs.insert(*makeLargeData("ndn:/C"));
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), dataSize * 2);
+  cs.find(Interest("ndn:/A"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // small Data fits without eviction
+  shared_ptr<Data> dataD = makeData("ndn:/D");
+  dataD->setFreshnessPeriod(time::milliseconds(99999));
+  dataD->wireEncode();
+  cs.insert(*dataD);
+  BOOST_CHECK_EQUAL(cs.size(), 3);
+  BOOST_CHECK_EQUAL(cs.getNBytes(), dataSize * 2 + dataD->wireEncode().size());
+
+  // shrinking the byte limit evicts
+  cs.setByteLimit(dataSize);
+  BOOST_CHECK_LE(cs.getNBytes(), dataSize);
+  cs.find(Interest("ndn:/B"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+
+  // Data larger than byte limit is not admitted
+  cs.setByteLimit(dataSize - 1);
+  BOOST_CHECK_EQUAL(cs.insert(*makeLargeData("ndn:/E")), false);
+  cs.find(Interest("ndn:/E"),
+          bind([] { BOOST_CHECK(false); }),
+          bind([] { BOOST_CHECK(true); }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -0,0 +1,125 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs.hpp"
+#include "table/cs-policy-tinylfu.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace cs {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_AUTO_TEST_SUITE(CsTinyLfu)
+
+BOOST_FIXTURE_TEST_CASE(Sketch, BaseFixture)
+{
+  tinylfu::FrequencySketch sketch(1024);
+  BOOST_CHECK_EQUAL(sketch.getSampleSize(), 10240);
+  BOOST_CHECK_EQUAL(sketch.estimate(1), 0);
+
+  for (int i = 0; i < 5; ++i) {
+    sketch.increment(1);
+  }
+  BOOST_CHECK_GE(sketch.estimate(1), 5);
+
+  // counters saturate
+  for (int i = 0; i < 20; ++i) {
+    sketch.increment(2);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(2), tinylfu::FrequencySketch::MAX_COUNT);
+
+  // reaching sample size halves all counters
+  for (size_t h = 100; h < 100 + sketch.getSampleSize(); ++h) {
+    sketch.increment(h);
+  }
+  BOOST_CHECK_LE(sketch.estimate(2), tinylfu::FrequencySketch::MAX_COUNT / 2 + 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(Limit, BaseFixture)
+{
+  Cs cs(10);
+  cs.setPolicy(makePolicy(TinyLfuPolicy::POLICY_NAME));
+  BOOST_REQUIRE_EQUAL(cs.getPolicy()->getName(), TinyLfuPolicy::POLICY_NAME);
+  auto policy = static_cast<TinyLfuPolicy*>(cs.getPolicy());
+
+  for (int i = 0; i < 30; ++i) {
+    cs.insert(*makeData(Name("/A").appendNumber(i)));
+    BOOST_CHECK_LE(cs.size(), 10);
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 10);
+  BOOST_CHECK_EQUAL(policy->getSegmentSize(tinylfu::SEGMENT_WINDOW), 1);
+  BOOST_CHECK_EQUAL(policy->getSegmentSize(tinylfu::SEGMENT_WINDOW) +
+                    policy->getSegmentSize(tinylfu::SEGMENT_PROBATION) +
+                    policy->getSegmentSize(tinylfu::SEGMENT_PROTECTED), 10);
+
+  cs.setLimit(5);
+  BOOST_CHECK_EQUAL(cs.size(), 5);
+}
+
+BOOST_FIXTURE_TEST_CASE(ScanResistance, BaseFixture)
+{
+  Cs cs(100);
+  cs.setPolicy(unique_ptr<Policy>(new TinyLfuPolicy()));
+  auto policy = static_cast<TinyLfuPolicy*>(cs.getPolicy());
+
+  const int N_HOT = 50;
+  for (int i = 0; i < N_HOT; ++i) {
+    cs.insert(*makeData(Name("/hot").appendNumber(i)));
+  }
+  // push the last hot entry out of the window
+  cs.insert(*makeData("/warmup"));
+
+  for (int j = 0; j < 3; ++j) {
+    for (int i = 0; i < N_HOT; ++i) {
+      cs.find(Interest(Name("/hot").appendNumber(i)),
+              bind([] { BOOST_CHECK(true); }),
+              bind([] { BOOST_CHECK(false); }));
+    }
+  }
+  BOOST_CHECK_EQUAL(policy->getSegmentSize(tinylfu::SEGMENT_PROTECTED), N_HOT);
+
+  // one-off scan much larger than the CS
+  for (int i = 0; i < 1000; ++i) {
+    cs.insert(*makeData(Name("/scan").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(cs.size(), 100);
+
+  int nHits = 0;
+  for (int i = 0; i < N_HOT; ++i) {
+    cs.find(Interest(Name("/hot").appendNumber(i)),
+            bind([&nHits] { ++nHits; }),
+            bind([] {}));
+  }
+  BOOST_CHECK_EQUAL(nHits, N_HOT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace cs
+} // namespace nfd
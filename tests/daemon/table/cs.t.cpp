@@ -120,6 +120,50 @@ BOOST_AUTO_TEST_CASE(FullName)
   CHECK_CS_FIND(2);
 }
 
+BOOST_AUTO_TEST_CASE(ExactNameIndex)
+{
+  insert(1, "ndn:/A/B");
+  insert(2, "ndn:/A");
+  insert(3, "ndn:/A");
+
+  // without selectors: answered from exact Name index, must agree with leftmost lookup
+  uint32_t exactFound = 0;
+  startInterest("ndn:/A");
+  find([&exactFound] (uint32_t found) { exactFound = found; });
+  BOOST_CHECK(exactFound == 2 || exactFound == 3);
+
+  startInterest("ndn:/A")
+    .setChildSelector(0);
+  CHECK_CS_FIND(exactFound);
+
+  startInterest("ndn:/A/B");
+  CHECK_CS_FIND(1);
+
+  // no exact Name: falls back to prefix lookup
+  insert(4, "ndn:/C/D");
+  startInterest("ndn:/C");
+  CHECK_CS_FIND(4);
+}
+
+BOOST_AUTO_TEST_CASE(ExactNameIndexEvict)
+{
+  m_cs.setLimit(2);
+  insert(1, "ndn:/A");
+  insert(2, "ndn:/A");
+
+  startInterest("ndn:/A");
+  find([] (uint32_t found) { BOOST_CHECK(found == 1 || found == 2); });
+
+  insert(3, "ndn:/B"); // evicts Data 1
+  BOOST_CHECK_EQUAL(m_cs.size(), 2);
+  startInterest("ndn:/A");
+  CHECK_CS_FIND(2);
+
+  insert(4, "ndn:/C"); // evicts Data 2
+  startInterest("ndn:/A");
+  CHECK_CS_FIND(0);
+}
+
 BOOST_AUTO_TEST_CASE(Leftmost)
 {
   insert(1, "ndn:/A");
@@ -366,6 +410,35 @@ BOOST_AUTO_TEST_CASE(Enumeration)
   BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
 }
 
+BOOST_AUTO_TEST_CASE(SameNameData)
+{
+  Cs cs;
+
+  shared_ptr<Data> data1 = makeData("ndn:/A");
+  BOOST_CHECK_EQUAL(cs.insert(*data1), true);
+
+  // identical copy decoded from wire refreshes the existing entry
+  shared_ptr<Data> copy1 = make_shared<Data>(data1->wireEncode());
+  BOOST_CHECK_EQUAL(cs.insert(*copy1), true);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+
+  // same Name with different payload is a different Data
+  shared_ptr<Data> data2 = makeData("ndn:/A");
+  static const uint8_t content[] = {0x01};
+  data2->setContent(content, sizeof(content));
+  data2->wireEncode();
+  BOOST_CHECK_EQUAL(cs.insert(*data2), true);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  int nFound = 0;
+  cs.find(Interest(data2->getFullName()),
+          [&] (const Interest&, const Data& data) {
+            ++nFound;
+            BOOST_CHECK(data.getFullName() == data2->getFullName()); },
+          bind([] { BOOST_CHECK(false); }));
+  BOOST_CHECK_EQUAL(nFound, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
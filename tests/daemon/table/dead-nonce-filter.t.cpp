@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/dead-nonce-filter.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+BOOST_FIXTURE_TEST_SUITE(TableDeadNonceFilter, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  DeadNonceFilter::Options options;
+  options.nFilters = 3;
+  options.nExpectedEntries = 1000;
+  options.falsePositiveRate = 0.01;
+  DeadNonceFilter filter(options);
+
+  BOOST_CHECK_EQUAL(filter.getNFilters(), 3);
+  BOOST_CHECK_EQUAL(filter.getFalsePositiveRate(), 0.01);
+  BOOST_CHECK_GE(filter.getNHashes(), 1);
+  BOOST_CHECK_EQUAL(filter.getMemoryUsage(), 3 * filter.getNBitsPerFilter() / 8);
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_EQUAL(filter.estimateFalsePositiveRate(), 0.0);
+
+  const uint64_t entryA = 0x53b4eaa81f46372bULL;
+  BOOST_CHECK_EQUAL(filter.has(entryA), false);
+  filter.add(entryA);
+  BOOST_CHECK_EQUAL(filter.has(entryA), true);
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+
+  // entry survives until its filter is cleared
+  filter.rotate();
+  filter.rotate();
+  BOOST_CHECK_EQUAL(filter.has(entryA), true);
+  filter.rotate();
+  BOOST_CHECK_EQUAL(filter.has(entryA), false);
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  DeadNonceFilter::Options options;
+  options.nFilters = 2;
+  options.nExpectedEntries = 10000;
+  options.falsePositiveRate = 0.01;
+  DeadNonceFilter filter(options);
+
+  // fill both filters to the expected number of entries
+  uint64_t entry = 0;
+  for (int f = 0; f < 2; ++f) {
+    for (size_t i = 0; i < options.nExpectedEntries; ++i) {
+      entry += 0x9E3779B97F4A7C15ULL;
+      filter.add(entry);
+      BOOST_REQUIRE(filter.has(entry));
+    }
+    if (f == 0) {
+      filter.rotate();
+    }
+  }
+
+  double estimated = filter.estimateFalsePositiveRate();
+  BOOST_CHECK_LE(estimated, options.falsePositiveRate);
+
+  size_t nFalsePositives = 0;
+  const size_t N_PROBES = 100000;
+  for (size_t i = 0; i < N_PROBES; ++i) {
+    entry += 0x9E3779B97F4A7C15ULL;
+    nFalsePositives += filter.has(entry);
+  }
+  BOOST_CHECK_LE(static_cast<double>(nFalsePositives) / N_PROBES, options.falsePositiveRate * 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
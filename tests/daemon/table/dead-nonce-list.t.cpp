@@ -24,6 +24,7 @@
  */
 
 #include "table/dead-nonce-list.hpp"
+#include "table/name-tree.hpp"
 
 #include "tests/test-common.hpp"
 
@@ -50,6 +51,42 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
 }
 
+BOOST_AUTO_TEST_CASE(NameHash)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  const uint32_t nonce1 = 0x53b4eaa8;
+  const uint32_t nonce2 = 0x1f46372b;
+
+  NameTree nameTree;
+  size_t hashA = nameTree.lookup(nameA)->getHash();
+  size_t hashB = nameTree.lookup(nameB)->getHash();
+
+  DeadNonceList dnl;
+  dnl.add(hashA, 1, nonce1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(hashA, 1, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(hashA, 1, nonce2), false);
+  BOOST_CHECK_EQUAL(dnl.has(hashB, 1, nonce1), false);
+
+  dnl.add(nameB, nonce2);
+  BOOST_CHECK_EQUAL(dnl.has(hashB, 1, nonce2), true);
+}
+
+BOOST_AUTO_TEST_CASE(NameHashCollision)
+{
+  const uint32_t nonce = 0x53b4eaa8;
+
+  // /A/A/B and /B have the same NameTree hash, but different lengths
+  BOOST_REQUIRE_EQUAL(name_tree::computeHash("ndn:/A/A/B"), name_tree::computeHash("ndn:/B"));
+
+  DeadNonceList dnl;
+  dnl.add("ndn:/A/A/B", nonce);
+  BOOST_CHECK_EQUAL(dnl.has("ndn:/A/A/B", nonce), true);
+  BOOST_CHECK_EQUAL(dnl.has("ndn:/B", nonce), false);
+  BOOST_CHECK_EQUAL(dnl.has("ndn:/A/A", nonce), false);
+}
+
 BOOST_AUTO_TEST_CASE(MinLifetime)
 {
   BOOST_CHECK_THROW(DeadNonceList dnl(time::milliseconds::zero()), std::invalid_argument);
@@ -129,6 +166,34 @@ BOOST_FIXTURE_TEST_CASE(Lifetime, PeriodicalInsertionFixture)
   BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
 }
 
+BOOST_FIXTURE_TEST_CASE(FilterLifetime, PeriodicalInsertionFixture)
+{
+  const int RATE = DeadNonceList::INITIAL_CAPACITY / 2;
+  dnl.enableFilter(0.001, RATE / DeadNonceList::EXPECTED_MARK_COUNT);
+  BOOST_REQUIRE(dnl.getFilter() != nullptr);
+  BOOST_CHECK_EQUAL(dnl.getFilter()->getNFilters(), DeadNonceList::EXPECTED_MARK_COUNT + 1);
+
+  this->setRate(RATE);
+  this->advanceClocksByLifetime(10.0);
+
+  Name nameC("ndn:/C");
+  const uint32_t nonceC = 0x25390656;
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(0.5); // -50%, entry should exist
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(1.0); // +50%, entry should be gone
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+
+  dnl.disableFilter();
+  BOOST_CHECK(dnl.getFilter() == nullptr);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+}
+
 BOOST_FIXTURE_TEST_CASE(CapacityDown, PeriodicalInsertionFixture)
 {
   ssize_t cap0 = dnl.m_capacity;
@@ -24,6 +24,7 @@
  */
 
 #include "table/fib.hpp"
+#include "table/pit.hpp"
 #include "tests/daemon/face/dummy-face.hpp"
 
 #include "tests/test-common.hpp"
@@ -264,6 +265,83 @@ BOOST_AUTO_TEST_CASE(RemoveNextHopFromAllEntries)
   BOOST_CHECK_EQUAL(entry->getPrefix(), nameEmpty);
 }
 
+BOOST_AUTO_TEST_CASE(RemoveNextHopFaceIndex)
+{
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+
+  NameTree nameTree;
+  Fib fib(nameTree);
+
+  shared_ptr<fib::Entry> entryA = fib.insert("/A").first;
+  entryA->addNextHop(face1, 0);
+  entryA->addNextHop(face1, 10); // cost update does not duplicate the index record
+  entryA->addNextHop(face2, 0);
+
+  shared_ptr<fib::Entry> entryB = fib.insert("/B").first;
+  entryB->addNextHop(face1, 0);
+  entryB->removeNextHop(face1);
+  entryB->addNextHop(face2, 0);
+
+  // an erased entry is no longer indexed, even if it is still referenced
+  shared_ptr<fib::Entry> entryC = fib.insert("/C").first;
+  entryC->addNextHop(face1, 0);
+  fib.erase(*entryC);
+  entryC->addNextHop(face2, 0);
+  BOOST_CHECK_EQUAL(fib.size(), 2);
+
+  fib.removeNextHopFromAllEntries(face1);
+  BOOST_CHECK_EQUAL(fib.size(), 2);
+  BOOST_CHECK_EQUAL(entryA->hasNextHop(face1), false);
+  BOOST_CHECK_EQUAL(entryA->hasNextHop(face2), true);
+  BOOST_CHECK_EQUAL(entryB->hasNextHop(face2), true);
+  BOOST_CHECK_EQUAL(entryC->hasNextHop(face1), true);
+
+  fib.removeNextHopFromAllEntries(face2);
+  BOOST_CHECK_EQUAL(fib.size(), 0);
+  BOOST_CHECK_EQUAL(entryC->hasNextHop(face2), true);
+}
+
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchCache)
+{
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+
+  shared_ptr<Interest> interest = makeInterest("ndn:/A/B/C/D");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+
+  // the match cached on the NameTree entry is returned until the table changes
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), Name("ndn:/"));
+
+  shared_ptr<fib::Entry> entryA = fib.insert("ndn:/A").first;
+  entryA->addNextHop(face1, 0);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry), entryA);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry), entryA);
+
+  shared_ptr<fib::Entry> entryABC = fib.insert("ndn:/A/B/C").first;
+  entryABC->addNextHop(face2, 0);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry), entryABC);
+
+  entryABC->addNextHop(face1, 0);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry), entryABC);
+
+  fib.removeNextHopFromAllEntries(face2);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry), entryABC);
+
+  fib.removeNextHopFromAllEntries(face1);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), Name("ndn:/"));
+
+  entryA = fib.insert("ndn:/A").first;
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry), entryA);
+
+  fib.erase("ndn:/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitEntry)->getPrefix(), Name("ndn:/"));
+}
+
 BOOST_AUTO_TEST_CASE(RemoveNextHopFromManyEntries)
 {
   NameTree nameTree(16);
@@ -60,10 +60,10 @@ BOOST_AUTO_TEST_CASE(Entry)
   size_t hash = npe->getHash();
   BOOST_CHECK_EQUAL(hash, static_cast<size_t>(0));
 
-  shared_ptr<name_tree::Entry> parent = npe->getParent();
-  BOOST_CHECK(!static_cast<bool>(parent));
+  name_tree::Entry* parentPtr = npe->getParent();
+  BOOST_CHECK(parentPtr == nullptr);
 
-  std::vector<shared_ptr<name_tree::Entry> >& childList = npe->getChildren();
+  std::vector<name_tree::Entry*>& childList = npe->getChildren();
   BOOST_CHECK_EQUAL(childList.size(), static_cast<size_t>(0));
 
   shared_ptr<fib::Entry> fib = npe->getFibEntry();
@@ -78,9 +78,9 @@ BOOST_AUTO_TEST_CASE(Entry)
   BOOST_CHECK_EQUAL(npe->getHash(), static_cast<size_t>(12345));
 
   Name parentName("ndn:/named-data/research/abc/def");
-  parent = make_shared<name_tree::Entry>(parentName);
-  npe->setParent(parent);
-  BOOST_CHECK_EQUAL(npe->getParent(), parent);
+  shared_ptr<name_tree::Entry> parent = make_shared<name_tree::Entry>(parentName);
+  npe->setParent(parent.get());
+  BOOST_CHECK_EQUAL(npe->getParent(), parent.get());
 
   // Insert FIB
 
@@ -138,14 +138,14 @@ BOOST_AUTO_TEST_CASE(Basic)
   // validate lookup() and findExactMatch()
 
   Name nameAB ("/a/b");
-  BOOST_CHECK_EQUAL(npeABC->getParent(), nt.findExactMatch(nameAB));
-  BOOST_CHECK_EQUAL(npeABD->getParent(), nt.findExactMatch(nameAB));
+  BOOST_CHECK_EQUAL(npeABC->getParent(), nt.findExactMatch(nameAB).get());
+  BOOST_CHECK_EQUAL(npeABD->getParent(), nt.findExactMatch(nameAB).get());
 
   Name nameA ("/a");
-  BOOST_CHECK_EQUAL(npeAE->getParent(), nt.findExactMatch(nameA));
+  BOOST_CHECK_EQUAL(npeAE->getParent(), nt.findExactMatch(nameA).get());
 
   Name nameRoot ("/");
-  BOOST_CHECK_EQUAL(npeF->getParent(), nt.findExactMatch(nameRoot));
+  BOOST_CHECK_EQUAL(npeF->getParent(), nt.findExactMatch(nameRoot).get());
   BOOST_CHECK_EQUAL(nt.size(), 7);
 
   Name name0("/does/not/exist");
@@ -528,6 +528,115 @@ BOOST_AUTO_TEST_CASE(HashTableResizeShrink)
   BOOST_CHECK_EQUAL(nameTree.getNBuckets(), 16);
 }
 
+BOOST_AUTO_TEST_CASE(OpenAddressingResizeShrink)
+{
+  size_t nBuckets = 16;
+  NameTree nameTree(nBuckets, NameTree::OPEN_ADDRESSING_LAYOUT);
+  BOOST_CHECK_EQUAL(nameTree.getHashTableLayout(), NameTree::OPEN_ADDRESSING_LAYOUT);
+
+  Name prefix("/a/b/c/d/e/f/g/h"); // requires 9 slots
+
+  shared_ptr<name_tree::Entry> entry = nameTree.lookup(prefix);
+  BOOST_CHECK_EQUAL(nameTree.size(), 9);
+  BOOST_CHECK_EQUAL(nameTree.getNBuckets(), 32);
+  BOOST_CHECK_EQUAL(nameTree.findExactMatch(prefix), entry);
+
+  nameTree.eraseEntryIfEmpty(entry);
+  BOOST_CHECK_EQUAL(nameTree.size(), 0);
+  BOOST_CHECK_EQUAL(nameTree.getNBuckets(), 16);
+}
+
+// entries are found and enumerated while they are migrated between slot arrays
+BOOST_AUTO_TEST_CASE(OpenAddressingIncrementalResize)
+{
+  NameTree nt(16, NameTree::OPEN_ADDRESSING_LAYOUT);
+
+  const size_t N_NAMES = 2000;
+  std::vector<shared_ptr<name_tree::Entry>> leaves;
+  for (size_t i = 0; i < N_NAMES; ++i) {
+    Name name("/open");
+    name.appendNumber(i % 16).appendNumber(i);
+    leaves.push_back(nt.lookup(name));
+
+    // /open, 16 groups and i+1 leaves below the root
+    BOOST_REQUIRE_EQUAL(nt.size(), 2 + std::min<size_t>(i + 1, 16) + i + 1);
+    BOOST_REQUIRE_EQUAL(nt.findExactMatch(name), leaves.back());
+    BOOST_REQUIRE_EQUAL(nt.lookup(name), leaves.back());
+  }
+  BOOST_CHECK_GE(nt.getNBuckets(), nt.size() * 2);
+
+  for (const shared_ptr<name_tree::Entry>& leaf : leaves) {
+    BOOST_CHECK_EQUAL(nt.findExactMatch(leaf->getPrefix()), leaf);
+    Name child = leaf->getPrefix();
+    child.append("child");
+    BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(child), leaf);
+  }
+
+  std::set<Name> seenNames;
+  for (const name_tree::Entry& nte : nt.fullEnumerate()) {
+    BOOST_CHECK(seenNames.insert(nte.getPrefix()).second);
+  }
+  BOOST_CHECK_EQUAL(seenNames.size(), nt.size());
+
+  // erase every other leaf, while the shrunk slot arrays are being migrated
+  for (size_t i = 0; i < N_NAMES; i += 2) {
+    nt.eraseEntryIfEmpty(leaves[i]);
+    BOOST_REQUIRE(!static_cast<bool>(nt.findExactMatch(leaves[i]->getPrefix())));
+  }
+  for (size_t i = 1; i < N_NAMES; i += 2) {
+    BOOST_CHECK_EQUAL(nt.findExactMatch(leaves[i]->getPrefix()), leaves[i]);
+  }
+
+  size_t nEnumerated = 0;
+  for (const name_tree::Entry& nte : nt.fullEnumerate()) {
+    BOOST_CHECK(nt.findExactMatch(nte.getPrefix()) != nullptr);
+    ++nEnumerated;
+  }
+  BOOST_CHECK_EQUAL(nEnumerated, nt.size());
+
+  for (size_t i = 1; i < N_NAMES; i += 2) {
+    nt.eraseEntryIfEmpty(leaves[i]);
+  }
+  BOOST_CHECK_EQUAL(nt.size(), 0);
+  BOOST_CHECK_EQUAL(nt.getNBuckets(), 16);
+  BOOST_CHECK(nt.begin() == nt.end());
+}
+
+// /a/b and /b/a have the same hash value, and must be kept apart
+BOOST_AUTO_TEST_CASE(LookupHashCollision)
+{
+  NameTree nt(16);
+
+  shared_ptr<name_tree::Entry> npeAB = nt.lookup("/a/b");
+  shared_ptr<name_tree::Entry> npeBA = nt.lookup("/b/a");
+  BOOST_CHECK_EQUAL(npeAB->getHash(), npeBA->getHash());
+  BOOST_CHECK_NE(npeAB, npeBA);
+  BOOST_CHECK_EQUAL(npeAB->getPrefix(), Name("/a/b"));
+  BOOST_CHECK_EQUAL(npeBA->getPrefix(), Name("/b/a"));
+  BOOST_CHECK_EQUAL(nt.size(), 5);
+
+  BOOST_CHECK_EQUAL(nt.lookup("/a/b"), npeAB);
+  BOOST_CHECK_EQUAL(nt.lookup("/b/a"), npeBA);
+  BOOST_CHECK_EQUAL(nt.findExactMatch("/b/a"), npeBA);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch("/b/a/c"), npeBA);
+  BOOST_CHECK_EQUAL(nt.size(), 5);
+
+  // /a/b/c reuses /a/b and only creates the last entry
+  shared_ptr<name_tree::Entry> npeABC = nt.lookup("/a/b/c");
+  BOOST_CHECK_EQUAL(npeABC->getParent(), npeAB.get());
+  BOOST_CHECK_EQUAL(npeAB->getChildren().size(), 1);
+  BOOST_CHECK_EQUAL(npeBA->getChildren().size(), 0);
+  BOOST_CHECK_EQUAL(nt.size(), 6);
+
+  // /c/b/a has the same hash value as /a/b/c, and its ancestors are created
+  shared_ptr<name_tree::Entry> npeCBA = nt.lookup("/c/b/a");
+  BOOST_CHECK_NE(npeCBA, npeABC);
+  BOOST_CHECK_EQUAL(npeCBA->getPrefix(), Name("/c/b/a"));
+  BOOST_CHECK_EQUAL(npeCBA->getParent()->getPrefix(), Name("/c/b"));
+  BOOST_CHECK_EQUAL(npeCBA->getParent()->getParent()->getPrefix(), Name("/c"));
+  BOOST_CHECK_EQUAL(nt.size(), 9);
+}
+
 // .lookup should not invalidate iterator
 BOOST_AUTO_TEST_CASE(SurvivedIteratorAfterLookup)
 {
@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit-entry-pool.hpp"
+#include "table/pit.hpp"
+#include "table/sit.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace pit {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_FIXTURE_TEST_SUITE(TablePitEntryPool, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(BlockPoolReuse)
+{
+  BlockPool pool;
+  BOOST_CHECK_EQUAL(pool.getBlockSize(), 0);
+  BOOST_CHECK_EQUAL(pool.getCapacity(), 0);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 100; ++i) {
+    blocks.push_back(pool.allocate(40));
+  }
+  BOOST_CHECK_GE(pool.getBlockSize(), 40);
+  BOOST_CHECK_EQUAL(pool.getBlockSize() % 16, 0);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 100);
+  BOOST_CHECK_GE(pool.getCapacity(), 100);
+  BOOST_CHECK_EQUAL(pool.getNReused(), 0);
+
+  void* freed = blocks.back();
+  blocks.pop_back();
+  pool.deallocate(freed, 40);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 99);
+  BOOST_CHECK_EQUAL(pool.getNPeakInUse(), 100);
+
+  size_t capacity = pool.getCapacity();
+  blocks.push_back(pool.allocate(40));
+  BOOST_CHECK_EQUAL(blocks.back(), freed);
+  BOOST_CHECK_EQUAL(pool.getNReused(), 1);
+  BOOST_CHECK_EQUAL(pool.getCapacity(), capacity);
+
+  // a request larger than the block size bypasses the pool
+  void* large = pool.allocate(pool.getBlockSize() + 1);
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 100);
+  pool.deallocate(large, pool.getBlockSize() + 1);
+
+  for (void* block : blocks) {
+    pool.deallocate(block, 40);
+  }
+  BOOST_CHECK_EQUAL(pool.getNInUse(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PitAndSit)
+{
+  EntryPool pool;
+  NameTree nameTree(16);
+  Pit pit(nameTree, &pool);
+  Sit sit(nameTree, &pool);
+
+  shared_ptr<Interest> interestA = makeInterest("/A");
+  shared_ptr<Interest> interestB = makeInterest("/B");
+  shared_ptr<Interest> interestS = makeInterest("/S");
+
+  shared_ptr<Entry> entryA = pit.insert(*interestA).first;
+  shared_ptr<Entry> entryB = pit.insert(*interestB).first;
+  shared_ptr<SitEntry> entryS = sit.insert(*interestS).first;
+  BOOST_CHECK_EQUAL(pool.getEntryPool().getNInUse(), 2);
+  BOOST_CHECK_EQUAL(pool.getSitEntryPool().getNInUse(), 1);
+
+  pit.erase(entryA);
+  entryA.reset();
+  BOOST_CHECK_EQUAL(pool.getEntryPool().getNInUse(), 1);
+
+  // the slot freed by /A is reused by /C
+  shared_ptr<Interest> interestC = makeInterest("/C");
+  shared_ptr<Entry> entryC = pit.insert(*interestC).first;
+  BOOST_CHECK_EQUAL(pool.getEntryPool().getNInUse(), 2);
+  BOOST_CHECK_EQUAL(pool.getEntryPool().getNReused(), 1);
+  BOOST_CHECK_EQUAL(pool.getEntryPool().getNPeakInUse(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace pit
+} // namespace nfd
@@ -0,0 +1,549 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/sit.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace pit {
+namespace tests {
+
+using namespace nfd::tests;
+
+BOOST_FIXTURE_TEST_SUITE(TableSit, BaseFixture)
+
+BOOST_AUTO_TEST_CASE(Insert)
+{
+  NameTree nameTree;
+  Sit sit(nameTree);
+
+  shared_ptr<Interest> interestA = makeInterest("ndn:/A");
+  shared_ptr<Interest> interestA2 = makeInterest("ndn:/A");
+  shared_ptr<Interest> interestAmin = makeInterest("ndn:/A");
+  interestAmin->setMinSuffixComponents(3);
+
+  std::pair<shared_ptr<SitEntry>, bool> insertResult;
+
+  insertResult = sit.insert(*interestA);
+  BOOST_CHECK_EQUAL(insertResult.second, true);
+  BOOST_CHECK_EQUAL(sit.size(), 1);
+
+  insertResult = sit.insert(*interestA2);
+  BOOST_CHECK_EQUAL(insertResult.second, false);
+  BOOST_CHECK_EQUAL(sit.size(), 1);
+
+  insertResult = sit.insert(*interestAmin);
+  BOOST_CHECK_EQUAL(insertResult.second, true);
+  BOOST_CHECK_EQUAL(sit.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(EntryInRecordIndex)
+{
+  size_t oldThreshold = getFaceRecordIndexThreshold();
+  setFaceRecordIndexThreshold(4);
+
+  shared_ptr<Interest> interest = makeInterest("ndn:/A");
+  SitEntry entry(*interest);
+
+  std::vector<shared_ptr<Face>> faces;
+  for (size_t i = 0; i < 10; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+    entry.insertOrUpdateInRecord(faces.back(), *interest);
+    entry.Entry::insertOrUpdateInRecord(faces.back(), *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), 10);
+  BOOST_CHECK_EQUAL(entry.Entry::getInRecords().size(), 10);
+
+  // refreshing existing InRecords, after the index is built, does not add InRecords
+  for (const shared_ptr<Face>& face : faces) {
+    entry.insertOrUpdateInRecord(face, *interest);
+    entry.Entry::insertOrUpdateInRecord(face, *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), 10);
+  BOOST_CHECK_EQUAL(entry.Entry::getInRecords().size(), 10);
+
+  for (const shared_ptr<Face>& face : faces) {
+    BOOST_REQUIRE(entry.getInRecord(*face) != entry.getInRecords().end());
+    BOOST_CHECK_EQUAL(entry.getInRecord(*face)->getFace(), face);
+    BOOST_REQUIRE(entry.Entry::getInRecord(*face) != entry.Entry::getInRecords().end());
+    BOOST_CHECK_EQUAL(entry.Entry::getInRecord(*face)->getFace(), face);
+  }
+
+  DummyFace otherFace;
+  BOOST_CHECK(entry.getInRecord(otherFace) == entry.getInRecords().end());
+
+  entry.deleteInRecords();
+  BOOST_CHECK(entry.Entry::getInRecord(*faces.front()) == entry.Entry::getInRecords().end());
+  entry.Entry::insertOrUpdateInRecord(faces.front(), *interest);
+  BOOST_CHECK_EQUAL(entry.Entry::getInRecords().size(), 1);
+
+  // getLastForwarded is the latest forwarding time of any InRecord
+  BOOST_CHECK(entry.getLastForwarded() == time::steady_clock::TimePoint::min());
+  entry.forwardInterest(faces[3]);
+  time::steady_clock::TimePoint forwarded = entry.getInRecord(*faces[3])->getLastForwarded();
+  BOOST_CHECK(forwarded > time::steady_clock::TimePoint::min());
+  BOOST_CHECK(entry.getLastForwarded() == forwarded);
+  entry.forwardInterest(make_shared<DummyFace>());
+  BOOST_CHECK(entry.getLastForwarded() == forwarded);
+
+  setFaceRecordIndexThreshold(oldThreshold);
+}
+
+BOOST_FIXTURE_TEST_CASE(LeaseSweep, UnitTestTimeFixture)
+{
+  NameTree nameTree;
+  Sit sit(nameTree);
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  shared_ptr<Face> face2 = make_shared<DummyFace>();
+
+  shared_ptr<Interest> interestShort = makeInterest("ndn:/A");
+  interestShort->setInterestLifetime(time::seconds(1));
+  shared_ptr<Interest> interestLong = makeInterest("ndn:/A");
+  interestLong->setInterestLifetime(time::seconds(3));
+
+  shared_ptr<Interest> interestA = makeInterest("ndn:/A");
+  shared_ptr<Interest> interestB = makeInterest("ndn:/B");
+  shared_ptr<Interest> interestC = makeInterest("ndn:/C");
+  shared_ptr<SitEntry> entryA = sit.insert(*interestA).first;
+  shared_ptr<SitEntry> entryB = sit.insert(*interestB).first;
+  shared_ptr<SitEntry> entryC = sit.insert(*interestC).first;
+  entryA->Entry::insertOrUpdateInRecord(face1, *interestShort);
+  entryB->Entry::insertOrUpdateInRecord(face1, *interestLong);
+  entryC->Entry::insertOrUpdateInRecord(face1, *interestShort);
+  entryC->Entry::insertOrUpdateInRecord(face2, *interestLong);
+  entryC->insertOrUpdateInRecord(face2, *interestLong);
+  BOOST_CHECK_EQUAL(sit.size(), 3);
+
+  std::vector<shared_ptr<SitEntry>> expired;
+  auto beforeErase = [&expired] (const shared_ptr<SitEntry>& entry) {
+    expired.push_back(entry);
+  };
+
+  // nothing has expired
+  BOOST_CHECK_EQUAL(sit.sweep(10, beforeErase), 0);
+  BOOST_CHECK_EQUAL(sit.size(), 3);
+
+  // A has expired, C keeps the subscriber with a longer lease
+  this->advanceClocks(time::milliseconds(100), time::seconds(2));
+  BOOST_CHECK_EQUAL(sit.sweep(10, beforeErase), 1);
+  BOOST_CHECK_EQUAL(sit.size(), 2);
+  BOOST_REQUIRE_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(expired[0], entryA);
+  BOOST_CHECK_EQUAL(entryC->Entry::getInRecords().size(), 1);
+  BOOST_CHECK_EQUAL(entryC->getInRecords().size(), 1);
+  BOOST_CHECK(nameTree.findExactMatch("ndn:/A") == nullptr);
+
+  // a refresh extends the lease
+  shared_ptr<Interest> interestRefresh = makeInterest("ndn:/B");
+  interestRefresh->setInterestLifetime(time::seconds(3));
+  entryB->Entry::insertOrUpdateInRecord(face1, *interestRefresh);
+
+  // each sweep visits a bounded number of entries
+  this->advanceClocks(time::milliseconds(100), time::seconds(2));
+  BOOST_CHECK_EQUAL(sit.sweep(1, beforeErase) + sit.sweep(1, beforeErase), 1);
+  BOOST_CHECK_EQUAL(sit.size(), 1);
+  BOOST_REQUIRE_EQUAL(expired.size(), 2);
+  BOOST_CHECK_EQUAL(expired[1], entryC);
+  BOOST_CHECK_EQUAL(entryC->getInRecords().size(), 0);
+
+  this->advanceClocks(time::milliseconds(100), time::seconds(2));
+  BOOST_CHECK_EQUAL(sit.sweep(10), 1);
+  BOOST_CHECK_EQUAL(sit.size(), 0);
+
+  // an entry can be inserted again after it has expired
+  BOOST_CHECK_EQUAL(sit.insert(*interestA).second, true);
+  BOOST_CHECK_EQUAL(sit.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FindAllDataMatches)
+{
+  NameTree nameTree;
+  Sit sit(nameTree);
+
+  shared_ptr<Interest> interestRoot = makeInterest("ndn:/");
+  shared_ptr<Interest> interestA = makeInterest("ndn:/A");
+  shared_ptr<Interest> interestAB = makeInterest("ndn:/A/B");
+  shared_ptr<Interest> interestAmin = makeInterest("ndn:/A");
+  interestAmin->setMinSuffixComponents(4);
+  shared_ptr<Interest> interestAmax = makeInterest("ndn:/A");
+  interestAmax->setMaxSuffixComponents(2);
+  shared_ptr<Interest> interestAexclude = makeInterest("ndn:/A");
+  interestAexclude->setExclude(Exclude().excludeOne(name::Component("B")));
+  shared_ptr<Interest> interestBA = makeInterest("ndn:/B/A");
+  shared_ptr<Interest> interestABC = makeInterest("ndn:/A/B/C");
+
+  shared_ptr<SitEntry> entryRoot = sit.insert(*interestRoot).first;
+  shared_ptr<SitEntry> entryA = sit.insert(*interestA).first;
+  shared_ptr<SitEntry> entryAB = sit.insert(*interestAB).first;
+  shared_ptr<SitEntry> entryAmin = sit.insert(*interestAmin).first;
+  shared_ptr<SitEntry> entryAmax = sit.insert(*interestAmax).first;
+  shared_ptr<SitEntry> entryAexclude = sit.insert(*interestAexclude).first;
+  shared_ptr<SitEntry> entryBA = sit.insert(*interestBA).first;
+  shared_ptr<SitEntry> entryABC = sit.insert(*interestABC).first;
+
+  auto getMatches = [&sit] (const Name& dataName) -> std::set<shared_ptr<SitEntry>> {
+    shared_ptr<Data> data = makeData(dataName);
+    SitDataMatchResult matches = sit.findAllDataMatches(*data);
+    return std::set<shared_ptr<SitEntry>>(matches.begin(), matches.end());
+  };
+
+  // /B/A has the same NameTree hash as /A/B
+  std::set<shared_ptr<SitEntry>> matchesAB = getMatches("ndn:/A/B");
+  BOOST_CHECK_EQUAL(matchesAB.size(), 4);
+  BOOST_CHECK_EQUAL(matchesAB.count(entryRoot), 1);
+  BOOST_CHECK_EQUAL(matchesAB.count(entryA), 1);
+  BOOST_CHECK_EQUAL(matchesAB.count(entryAB), 1);
+  BOOST_CHECK_EQUAL(matchesAB.count(entryAmax), 1);
+
+  std::set<shared_ptr<SitEntry>> matchesACDE = getMatches("ndn:/A/C/D/E");
+  BOOST_CHECK_EQUAL(matchesACDE.size(), 4);
+  BOOST_CHECK_EQUAL(matchesACDE.count(entryRoot), 1);
+  BOOST_CHECK_EQUAL(matchesACDE.count(entryA), 1);
+  BOOST_CHECK_EQUAL(matchesACDE.count(entryAmin), 1);
+  BOOST_CHECK_EQUAL(matchesACDE.count(entryAexclude), 1);
+
+  std::set<shared_ptr<SitEntry>> matchesC = getMatches("ndn:/C");
+  BOOST_CHECK_EQUAL(matchesC.size(), 1);
+  BOOST_CHECK_EQUAL(matchesC.count(entryRoot), 1);
+
+  sit.erase(entryAB);
+  sit.erase(entryRoot);
+  matchesAB = getMatches("ndn:/A/B");
+  BOOST_CHECK_EQUAL(matchesAB.size(), 2);
+  BOOST_CHECK_EQUAL(matchesAB.count(entryA), 1);
+  BOOST_CHECK_EQUAL(matchesAB.count(entryAmax), 1);
+
+  std::set<shared_ptr<SitEntry>> matchesBA = getMatches("ndn:/B/A/1");
+  BOOST_CHECK_EQUAL(matchesBA.size(), 1);
+  BOOST_CHECK_EQUAL(matchesBA.count(entryBA), 1);
+
+  std::set<shared_ptr<SitEntry>> matchesABC = getMatches("ndn:/A/B/C");
+  BOOST_CHECK_EQUAL(matchesABC.count(entryABC), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FindAllPitAndSitMatches)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  Sit sit(nameTree);
+
+  shared_ptr<Entry> pitEntryA = pit.insert(*makeInterest("ndn:/A")).first;
+  shared_ptr<Entry> pitEntryABC = pit.insert(*makeInterest("ndn:/A/B/C")).first;
+  shared_ptr<Entry> pitEntryD = pit.insert(*makeInterest("ndn:/D")).first;
+  shared_ptr<SitEntry> sitEntryA = sit.insert(*makeInterest("ndn:/A")).first;
+  shared_ptr<SitEntry> sitEntryAB = sit.insert(*makeInterest("ndn:/A/B")).first;
+  shared_ptr<Interest> interestABmax = makeInterest("ndn:/A/B");
+  interestABmax->setMaxSuffixComponents(1);
+  shared_ptr<SitEntry> sitEntryABmax = sit.insert(*interestABmax).first;
+
+  shared_ptr<Data> data = makeData("ndn:/A/B/C/D");
+  CombinedDataMatchResult result = sit.findAllPitAndSitMatches(*data);
+
+  DataMatchResult pitMatches = pit.findAllDataMatches(*data);
+  BOOST_CHECK_EQUAL(result.pitMatches.size(), pitMatches.size());
+  BOOST_CHECK(std::set<shared_ptr<Entry>>(result.pitMatches.begin(), result.pitMatches.end()) ==
+              std::set<shared_ptr<Entry>>(pitMatches.begin(), pitMatches.end()));
+  BOOST_CHECK_EQUAL(result.pitMatches.size(), 2);
+
+  BOOST_REQUIRE_EQUAL(result.sitMatches.size(), 2);
+  std::set<shared_ptr<SitEntry>> sitMatches(result.sitMatches.begin(), result.sitMatches.end());
+  BOOST_CHECK_EQUAL(sitMatches.count(sitEntryA), 1);
+  BOOST_CHECK_EQUAL(sitMatches.count(sitEntryAB), 1);
+
+  // /A/B/C, /A/B, /A visited; /A/B/C/D and / have no PIT or SIT entries
+  BOOST_CHECK_EQUAL(result.nNameTreeEntries, 3);
+  BOOST_CHECK_EQUAL(result.nPitEntries, 2);
+  BOOST_CHECK_EQUAL(result.nSitEntries, 3);
+}
+
+BOOST_AUTO_TEST_CASE(FullNameSubscriptions)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  Sit sit(nameTree);
+
+  shared_ptr<Data> data = makeData("ndn:/A/B");
+  shared_ptr<Data> otherData = makeData("ndn:/A/B");
+  otherData->setContent(reinterpret_cast<const uint8_t*>("other"), 5);
+  signData(otherData);
+
+  shared_ptr<SitEntry> entryA = sit.insert(*makeInterest("ndn:/A")).first;
+  shared_ptr<SitEntry> entryFull = sit.insert(*makeInterest(data->getFullName())).first;
+  shared_ptr<SitEntry> entryOtherFull = sit.insert(*makeInterest(otherData->getFullName())).first;
+
+  SitDataMatchResult matches = sit.findAllDataMatches(*data);
+  std::set<shared_ptr<SitEntry>> matchSet(matches.begin(), matches.end());
+  BOOST_CHECK_EQUAL(matchSet.size(), 2);
+  BOOST_CHECK_EQUAL(matchSet.count(entryA), 1);
+  BOOST_CHECK_EQUAL(matchSet.count(entryFull), 1);
+
+  CombinedDataMatchResult result = sit.findAllPitAndSitMatches(*otherData);
+  std::set<shared_ptr<SitEntry>> combinedSet(result.sitMatches.begin(), result.sitMatches.end());
+  BOOST_CHECK_EQUAL(combinedSet.size(), 2);
+  BOOST_CHECK_EQUAL(combinedSet.count(entryA), 1);
+  BOOST_CHECK_EQUAL(combinedSet.count(entryOtherFull), 1);
+
+  sit.erase(entryFull);
+  sit.erase(entryOtherFull);
+  matches = sit.findAllDataMatches(*data);
+  BOOST_REQUIRE_EQUAL(matches.size(), 1);
+  BOOST_CHECK(matches.front() == entryA);
+}
+
+BOOST_AUTO_TEST_CASE(SubscriptionMatcherSelectors)
+{
+  shared_ptr<Interest> interest = makeInterest("ndn:/A");
+  BOOST_CHECK_EQUAL(SubscriptionMatcher(*interest).matchesAll(), true);
+
+  interest->setMinSuffixComponents(1);
+  BOOST_CHECK_EQUAL(SubscriptionMatcher(*interest).matchesAll(), true);
+
+  interest->setMinSuffixComponents(2);
+  SubscriptionMatcher matcherMin(*interest);
+  BOOST_CHECK_EQUAL(matcherMin.matchesAll(), false);
+  BOOST_CHECK_EQUAL(matcherMin.matches(*interest, *makeData("ndn:/A")), false);
+  BOOST_CHECK_EQUAL(matcherMin.matches(*interest, *makeData("ndn:/A/B")), true);
+}
+
+BOOST_AUTO_TEST_CASE(ComponentIntervalIndex)
+{
+  IntervalIndex<int> index;
+  index.insert(ComponentInterval(name::Component::fromNumber(10),
+                                 name::Component::fromNumber(20)), 1);
+  index.insert(ComponentInterval(name::Component::fromNumber(15),
+                                 name::Component::fromNumber(30)), 2);
+  index.insert(ComponentInterval(name::Component(), name::Component::fromNumber(5)), 3);
+  ComponentInterval unbounded;
+  unbounded.low = name::Component::fromNumber(25);
+  index.insert(unbounded, 4);
+
+  auto stab = [&index] (uint64_t number) -> std::set<int> {
+    std::set<int> values;
+    index.visit(name::Component::fromNumber(number),
+                [&values] (int value) { values.insert(value); });
+    return values;
+  };
+
+  BOOST_CHECK(stab(0) == std::set<int>({3}));
+  BOOST_CHECK(stab(12) == std::set<int>({1}));
+  BOOST_CHECK(stab(20) == std::set<int>({1, 2}));
+  BOOST_CHECK(stab(27) == std::set<int>({2, 4}));
+  BOOST_CHECK(stab(1000000) == std::set<int>({4}));
+  BOOST_CHECK(stab(7) == std::set<int>());
+
+  BOOST_CHECK_EQUAL(index.erase(ComponentInterval(name::Component::fromNumber(15),
+                                                  name::Component::fromNumber(30)),
+                                [] (int value) { return value == 2; }), 1);
+  BOOST_CHECK_EQUAL(index.erase(ComponentInterval(name::Component::fromNumber(15),
+                                                  name::Component::fromNumber(30)),
+                                [] (int value) { return value == 2; }), 0);
+  BOOST_CHECK_EQUAL(index.size(), 3);
+  BOOST_CHECK(stab(20) == std::set<int>({1}));
+  BOOST_CHECK(stab(27) == std::set<int>({4}));
+}
+
+/** \brief checks that intervals are well-formed, and cover every number from 0 to 40
+ *         that exclude allows
+ */
+static void
+checkAllowedIntervals(const Exclude& exclude, const std::vector<ComponentInterval>& intervals)
+{
+  for (const ComponentInterval& interval : intervals) {
+    BOOST_CHECK(!interval.hasHigh || interval.low <= interval.high);
+  }
+
+  for (uint64_t number = 0; number <= 40; ++number) {
+    name::Component component = name::Component::fromNumber(number);
+    bool isCovered = std::any_of(intervals.begin(), intervals.end(),
+      [&component] (const ComponentInterval& interval) { return interval.contains(component); });
+    BOOST_CHECK_MESSAGE(exclude.isExcluded(component) || isCovered,
+                        "allowed component " << number << " is not covered");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AllowedIntervals)
+{
+  BOOST_CHECK_EQUAL(getAllowedIntervals(Exclude()).size(), 0);
+
+  // sequence numbers from 10
+  Exclude before;
+  before.excludeBefore(name::Component::fromNumber(9));
+  std::vector<ComponentInterval> beforeIntervals = getAllowedIntervals(before);
+  BOOST_REQUIRE_EQUAL(beforeIntervals.size(), 1);
+  BOOST_CHECK_EQUAL(beforeIntervals[0].low, name::Component::fromNumber(9));
+  BOOST_CHECK_EQUAL(beforeIntervals[0].hasHigh, false);
+  checkAllowedIntervals(before, beforeIntervals);
+  BOOST_CHECK(beforeIntervals[0].contains(name::Component::fromNumber(1000)));
+  BOOST_CHECK(!beforeIntervals[0].contains(name::Component::fromNumber(5)));
+
+  // sequence numbers up to 20
+  Exclude after;
+  after.excludeAfter(name::Component::fromNumber(21));
+  std::vector<ComponentInterval> afterIntervals = getAllowedIntervals(after);
+  BOOST_REQUIRE_EQUAL(afterIntervals.size(), 1);
+  BOOST_CHECK_EQUAL(afterIntervals[0].low, name::Component());
+  BOOST_CHECK_EQUAL(afterIntervals[0].hasHigh, true);
+  BOOST_CHECK_EQUAL(afterIntervals[0].high, name::Component::fromNumber(21));
+  checkAllowedIntervals(after, afterIntervals);
+
+  // sequence numbers 10 to 20
+  Exclude range;
+  range.excludeBefore(name::Component::fromNumber(9));
+  range.excludeAfter(name::Component::fromNumber(21));
+  std::vector<ComponentInterval> rangeIntervals = getAllowedIntervals(range);
+  BOOST_REQUIRE_EQUAL(rangeIntervals.size(), 1);
+  BOOST_CHECK_EQUAL(rangeIntervals[0].low, name::Component::fromNumber(9));
+  BOOST_CHECK_EQUAL(rangeIntervals[0].hasHigh, true);
+  BOOST_CHECK_EQUAL(rangeIntervals[0].high, name::Component::fromNumber(21));
+  checkAllowedIntervals(range, rangeIntervals);
+  BOOST_CHECK(!rangeIntervals[0].contains(name::Component::fromNumber(25)));
+
+  // any sequence number except 5 and 7
+  Exclude set;
+  set.excludeOne(name::Component::fromNumber(7));
+  set.excludeOne(name::Component::fromNumber(5));
+  std::vector<ComponentInterval> setIntervals = getAllowedIntervals(set);
+  BOOST_REQUIRE_EQUAL(setIntervals.size(), 3);
+  BOOST_CHECK_EQUAL(setIntervals[0].low, name::Component());
+  BOOST_CHECK_EQUAL(setIntervals[0].high, name::Component::fromNumber(5));
+  BOOST_CHECK_EQUAL(setIntervals[1].low, name::Component::fromNumber(5));
+  BOOST_CHECK_EQUAL(setIntervals[1].high, name::Component::fromNumber(7));
+  BOOST_CHECK_EQUAL(setIntervals[2].low, name::Component::fromNumber(7));
+  BOOST_CHECK_EQUAL(setIntervals[2].hasHigh, false);
+  checkAllowedIntervals(set, setIntervals);
+
+  Exclude all;
+  all.excludeAfter(name::Component());
+  BOOST_CHECK_EQUAL(getAllowedIntervals(all).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PredicateSubscriptions)
+{
+  NameTree nameTree;
+  Sit sit(nameTree);
+
+  auto makeRangeInterest = [] (uint64_t first, uint64_t last) -> shared_ptr<Interest> {
+    shared_ptr<Interest> interest = makeInterest("ndn:/sensor");
+    Exclude exclude;
+    exclude.excludeBefore(name::Component::fromNumber(first - 1));
+    exclude.excludeAfter(name::Component::fromNumber(last + 1));
+    interest->setExclude(exclude);
+    return interest;
+  };
+
+  shared_ptr<SitEntry> entry10to20 = sit.insert(*makeRangeInterest(10, 20)).first;
+  shared_ptr<SitEntry> entry15to30 = sit.insert(*makeRangeInterest(15, 30)).first;
+  shared_ptr<Interest> interestNot5or7 = makeInterest("ndn:/sensor");
+  interestNot5or7->setExclude(Exclude().excludeOne(name::Component::fromNumber(5))
+                                       .excludeOne(name::Component::fromNumber(7)));
+  shared_ptr<SitEntry> entryNot5or7 = sit.insert(*interestNot5or7).first;
+  shared_ptr<Interest> interestFrom20 = makeInterest("ndn:/sensor");
+  interestFrom20->setExclude(Exclude().excludeBefore(name::Component::fromNumber(19)));
+  shared_ptr<SitEntry> entryFrom20 = sit.insert(*interestFrom20).first;
+  shared_ptr<SitEntry> entryAll = sit.insert(*makeInterest("ndn:/sensor")).first;
+  std::vector<shared_ptr<SitEntry>> entries = {entry10to20, entry15to30, entryNot5or7,
+                                                entryFrom20, entryAll};
+
+  auto makeReading = [] (uint64_t number) -> shared_ptr<Data> {
+    Name dataName("ndn:/sensor");
+    dataName.appendNumber(number).append("reading");
+    return makeData(dataName);
+  };
+
+  auto getMatches = [&sit, &makeReading] (uint64_t number) -> std::set<shared_ptr<SitEntry>> {
+    SitDataMatchResult matches = sit.findAllDataMatches(*makeReading(number));
+    BOOST_CHECK_EQUAL(std::set<shared_ptr<SitEntry>>(matches.begin(), matches.end()).size(),
+                      matches.size());
+    return std::set<shared_ptr<SitEntry>>(matches.begin(), matches.end());
+  };
+
+  typedef std::set<shared_ptr<SitEntry>> EntrySet;
+  BOOST_CHECK(getMatches(12) == EntrySet({entry10to20, entryNot5or7, entryAll}));
+  BOOST_CHECK(getMatches(15) == EntrySet({entry10to20, entry15to30, entryNot5or7, entryAll}));
+  BOOST_CHECK(getMatches(25) == EntrySet({entry15to30, entryNot5or7, entryFrom20, entryAll}));
+  BOOST_CHECK(getMatches(7) == EntrySet({entryAll}));
+  BOOST_CHECK(getMatches(9) == EntrySet({entryNot5or7, entryAll}));
+  BOOST_CHECK(getMatches(1000) == EntrySet({entryNot5or7, entryFrom20, entryAll}));
+
+  // the index agrees with Interest::matchesData
+  for (uint64_t number = 0; number <= 40; ++number) {
+    shared_ptr<Data> data = makeReading(number);
+    EntrySet expected;
+    for (const shared_ptr<SitEntry>& entry : entries) {
+      if (entry->getInterest().matchesData(*data)) {
+        expected.insert(entry);
+      }
+    }
+    BOOST_CHECK_MESSAGE(getMatches(number) == expected, "mismatch at " << number);
+  }
+
+  sit.erase(entry15to30);
+  BOOST_CHECK(getMatches(25) == EntrySet({entryNot5or7, entryFrom20, entryAll}));
+  sit.erase(entryFrom20);
+  sit.erase(entry10to20);
+  sit.erase(entryNot5or7);
+  sit.erase(entryAll);
+  BOOST_CHECK_EQUAL(sit.size(), 0);
+  BOOST_CHECK_EQUAL(getMatches(12).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PredicateSubscriptionsScale)
+{
+  NameTree nameTree;
+  Sit sit(nameTree);
+
+  // 1000 subscribers, each to a disjoint range of 10 sequence numbers
+  std::vector<shared_ptr<SitEntry>> entries;
+  for (uint64_t i = 1; i <= 1000; ++i) {
+    shared_ptr<Interest> interest = makeInterest("ndn:/sensor");
+    Exclude exclude;
+    exclude.excludeBefore(name::Component::fromNumber(i * 10 - 1));
+    exclude.excludeAfter(name::Component::fromNumber(i * 10 + 10));
+    interest->setExclude(exclude);
+    entries.push_back(sit.insert(*interest).first);
+  }
+
+  Name dataName("ndn:/sensor");
+  dataName.appendNumber(5555);
+  CombinedDataMatchResult result = sit.findAllPitAndSitMatches(*makeData(dataName));
+  BOOST_REQUIRE_EQUAL(result.sitMatches.size(), 1);
+  BOOST_CHECK(result.sitMatches.front() == entries[554]);
+  BOOST_CHECK_LT(result.nSitEntries, 40);
+
+  // no subscriber above 10010
+  Name highName("ndn:/sensor");
+  highName.appendNumber(20000);
+  result = sit.findAllPitAndSitMatches(*makeData(highName));
+  BOOST_CHECK_EQUAL(result.sitMatches.size(), 0);
+  BOOST_CHECK_LT(result.nSitEntries, 40);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace pit
+} // namespace nfd
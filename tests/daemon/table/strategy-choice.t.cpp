@@ -124,6 +124,40 @@ BOOST_AUTO_TEST_CASE(Effective)
   BOOST_CHECK_EQUAL(table.findEffectiveStrategy("ndn:/D")  .getName(), nameQ);
 }
 
+BOOST_AUTO_TEST_CASE(EffectiveCache)
+{
+  Forwarder forwarder;
+  Name nameP("ndn:/strategy/P");
+  Name nameQ("ndn:/strategy/Q");
+  shared_ptr<Strategy> strategyP = make_shared<DummyStrategy>(ref(forwarder), nameP);
+  shared_ptr<Strategy> strategyQ = make_shared<DummyStrategy>(ref(forwarder), nameQ);
+
+  StrategyChoice& table = forwarder.getStrategyChoice();
+  table.install(strategyP);
+  table.install(strategyQ);
+  BOOST_CHECK(table.insert("ndn:/", nameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<Interest> interest = makeInterest("ndn:/A/B/C");
+  shared_ptr<pit::Entry> pitEntry = pit.insert(*interest).first;
+
+  // the result cached on the NameTree entry is returned until the table changes
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy(*pitEntry), strategyP.get());
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy(*pitEntry), strategyP.get());
+
+  BOOST_CHECK(table.insert("ndn:/A", nameQ));
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy(*pitEntry), strategyQ.get());
+
+  BOOST_CHECK(table.insert("ndn:/A/B/C", nameP));
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy(*pitEntry), strategyP.get());
+
+  table.erase("ndn:/A/B/C");
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy(*pitEntry), strategyQ.get());
+
+  table.erase("ndn:/A");
+  BOOST_CHECK_EQUAL(&table.findEffectiveStrategy(*pitEntry), strategyP.get());
+}
+
 //XXX BOOST_CONCEPT_ASSERT((ForwardIterator<std::vector<int>::iterator>))
 //    is also failing. There might be a problem with ForwardIterator concept checking.
 //BOOST_CONCEPT_ASSERT((ForwardIterator<StrategyChoice::const_iterator>));
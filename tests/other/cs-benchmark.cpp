@@ -159,6 +159,46 @@ BOOST_AUTO_TEST_CASE(InsertFindHit)
   BOOST_TEST_MESSAGE("insert-find(hit) " << (N_WORKLOAD * REPEAT) << ": " << d);
 }
 
+// find hit of exact-name Interests, with and without selectors
+BOOST_AUTO_TEST_CASE(ExactHit)
+{
+  const size_t N_WORKLOAD = CS_CAPACITY;
+  const size_t REPEAT = 4;
+
+  std::vector<shared_ptr<Interest>> interestWorkload = makeInterestWorkload(N_WORKLOAD);
+  std::vector<shared_ptr<Interest>> selectorWorkload = makeInterestWorkload(N_WORKLOAD);
+  for (auto&& interest : selectorWorkload) {
+    interest->setChildSelector(0);
+  }
+  std::vector<shared_ptr<Data>> dataWorkload = makeDataWorkload(N_WORKLOAD);
+  for (auto&& data : dataWorkload) {
+    cs.insert(*data, false);
+  }
+  BOOST_REQUIRE(cs.size() == N_WORKLOAD);
+
+  time::microseconds d1 = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const auto& interest : interestWorkload) {
+        find(*interest);
+      }
+    }
+  });
+  BOOST_TEST_MESSAGE("find(exact, no selectors) " << (N_WORKLOAD * REPEAT) << ": " << d1 <<
+                     ", " << (d1.count() * 1000 / static_cast<int64_t>(N_WORKLOAD * REPEAT)) <<
+                     " ns/lookup");
+
+  time::microseconds d2 = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const auto& interest : selectorWorkload) {
+        find(*interest);
+      }
+    }
+  });
+  BOOST_TEST_MESSAGE("find(exact, ChildSelector) " << (N_WORKLOAD * REPEAT) << ": " << d2 <<
+                     ", " << (d2.count() * 1000 / static_cast<int64_t>(N_WORKLOAD * REPEAT)) <<
+                     " ns/lookup");
+}
+
 // find(leftmost) hit
 BOOST_AUTO_TEST_CASE(Leftmost)
 {
@@ -217,6 +257,49 @@ BOOST_AUTO_TEST_CASE(Rightmost)
   BOOST_TEST_MESSAGE("find(rightmost) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d);
 }
 
+// insert large payloads, then refresh them with identical copies
+BOOST_AUTO_TEST_CASE(InsertLargePayload)
+{
+  const size_t N_WORKLOAD = CS_CAPACITY / 10;
+  const size_t PAYLOAD_SIZE = 8000;
+
+  std::vector<uint8_t> payload(PAYLOAD_SIZE, 0xBB);
+  std::vector<shared_ptr<Data>> dataWorkload = makeDataWorkload(N_WORKLOAD);
+  std::vector<shared_ptr<Data>> copyWorkload(N_WORKLOAD);
+  std::vector<shared_ptr<Data>> hashWorkload(N_WORKLOAD);
+  for (size_t i = 0; i < N_WORKLOAD; ++i) {
+    dataWorkload[i]->setContent(payload.data(), payload.size());
+    const Block& wire = dataWorkload[i]->wireEncode();
+    // decoded copies have no cached full name, like packets received from a face
+    copyWorkload[i] = make_shared<Data>(wire);
+    hashWorkload[i] = make_shared<Data>(wire);
+  }
+
+  time::microseconds d1 = timedRun([&] {
+    for (size_t i = 0; i < N_WORKLOAD; ++i) {
+      cs.insert(*dataWorkload[i], false);
+    }
+  });
+  BOOST_REQUIRE(cs.size() == N_WORKLOAD);
+  BOOST_TEST_MESSAGE("insert(" << PAYLOAD_SIZE << " octets) " << N_WORKLOAD << ": " << d1);
+
+  time::microseconds d2 = timedRun([&] {
+    for (size_t i = 0; i < N_WORKLOAD; ++i) {
+      cs.insert(*copyWorkload[i], false);
+    }
+  });
+  BOOST_REQUIRE(cs.size() == N_WORKLOAD);
+  BOOST_TEST_MESSAGE("refresh(" << PAYLOAD_SIZE << " octets) " << N_WORKLOAD << ": " << d2);
+
+  // implicit digest computation that a digest-ordered index would pay on each insert
+  time::microseconds d3 = timedRun([&] {
+    for (size_t i = 0; i < N_WORKLOAD; ++i) {
+      hashWorkload[i]->getFullName();
+    }
+  });
+  BOOST_TEST_MESSAGE("getFullName(" << PAYLOAD_SIZE << " octets) " << N_WORKLOAD << ": " << d3);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace tests
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <cmath>
+#include <random>
+
+namespace nfd {
+namespace tests {
+
+/** \brief replays a synthetic request trace against the CS with each replacement policy
+ *
+ *  The trace mixes Zipf-distributed requests over a fixed catalog with periodic scans of
+ *  one-off Names, which is the access pattern of consumers fetching popular content while
+ *  other consumers retrieve long segmented objects.
+ *  Each request is a CS lookup; a miss is followed by insertion of the Data.
+ */
+class CsTraceBenchmarkFixture : public BaseFixture
+{
+protected:
+  CsTraceBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+
+    std::mt19937 rng(0x5EED);
+
+    // cumulative distribution of Zipf(ZIPF_ALPHA) over catalog ranks
+    std::vector<double> cdf(N_CATALOG);
+    double sum = 0.0;
+    for (size_t rank = 0; rank < N_CATALOG; ++rank) {
+      sum += 1.0 / std::pow(static_cast<double>(rank + 1), ZIPF_ALPHA);
+      cdf[rank] = sum;
+    }
+
+    std::vector<shared_ptr<Data>> catalog(N_CATALOG);
+    for (size_t rank = 0; rank < N_CATALOG; ++rank) {
+      catalog[rank] = makeData(Name("/trace/catalog").appendNumber(rank));
+    }
+
+    std::uniform_real_distribution<double> uniform(0.0, sum);
+    size_t nScanned = 0;
+    for (size_t i = 0; i < N_REQUESTS; ++i) {
+      shared_ptr<Data> data;
+      if (i % SCAN_PERIOD < SCAN_LENGTH) {
+        data = makeData(Name("/trace/scan").appendNumber(nScanned++));
+      }
+      else {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        data = catalog[std::min(rank, N_CATALOG - 1)];
+      }
+      m_trace.push_back(std::make_pair(make_shared<Interest>(data->getName()), data));
+    }
+  }
+
+  void
+  replay(const std::string& policyName)
+  {
+    Cs cs(CS_CAPACITY, cs::makePolicy(policyName));
+    size_t nHits = 0;
+
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    for (const auto& request : m_trace) {
+      bool isHit = false;
+      cs.find(*request.first,
+              bind([&isHit] { isHit = true; }),
+              bind([] {}));
+      if (isHit) {
+        ++nHits;
+      }
+      else {
+        cs.insert(*request.second, false);
+      }
+    }
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+
+    time::microseconds d = time::duration_cast<time::microseconds>(t2 - t1);
+    BOOST_TEST_MESSAGE(policyName << ": hit-ratio " <<
+                       (100.0 * nHits / m_trace.size()) << "%, " <<
+                       m_trace.size() << " requests in " << d << ", " <<
+                       (d.count() * 1000 / static_cast<int64_t>(m_trace.size())) << " ns/request");
+  }
+
+protected:
+  static const size_t N_CATALOG = 100000;
+  static const size_t N_REQUESTS = 1000000;
+  static const size_t CS_CAPACITY = 5000;
+  static const size_t SCAN_PERIOD = 10000;
+  static const size_t SCAN_LENGTH = 2000;
+  static constexpr double ZIPF_ALPHA = 0.8;
+
+  std::vector<std::pair<shared_ptr<Interest>, shared_ptr<Data>>> m_trace;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableCsTraceBenchmark, CsTraceBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(Fifo)
+{
+  replay("fifo");
+}
+
+BOOST_AUTO_TEST_CASE(Lru)
+{
+  replay("lru");
+}
+
+BOOST_AUTO_TEST_CASE(TinyLfu)
+{
+  replay("tinylfu");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/fib.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class FibBenchmarkFixture : public BaseFixture
+{
+protected:
+  FibBenchmarkFixture()
+    : nameTree(N_ENTRIES)
+    , fib(nameTree)
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+
+    for (size_t i = 0; i < N_FACES; ++i) {
+      faces.push_back(make_shared<DummyFace>());
+    }
+
+    for (size_t i = 0; i < N_ENTRIES; ++i) {
+      Name name("/fib/benchmark");
+      name.appendNumber(i % 1024).appendNumber(i / 1024);
+      shared_ptr<fib::Entry> entry = fib.insert(name).first;
+      entry->addNextHop(faces[i % N_FACES], 0);
+      entry->addNextHop(faces[(i + 1) % N_FACES], 10);
+    }
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+protected:
+  static const size_t N_ENTRIES = 1000000;
+  static const size_t N_FACES = 1000;
+
+  NameTree nameTree;
+  Fib fib;
+  std::vector<shared_ptr<Face>> faces;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableFibBenchmark, FibBenchmarkFixture)
+
+// face removal with 1M FIB entries, each face appears in 2000 entries
+BOOST_AUTO_TEST_CASE(RemoveNextHopFromAllEntries)
+{
+  BOOST_REQUIRE(fib.size() == N_ENTRIES);
+
+  // cost of the former implementation, which visited every NameTree entry
+  size_t nAffected = 0;
+  time::microseconds dEnumerate = timedRun([&] {
+    for (const fib::Entry& entry : fib) {
+      if (entry.hasNextHop(faces[0]))
+        ++nAffected;
+    }
+  });
+  BOOST_CHECK_EQUAL(nAffected, 2 * N_ENTRIES / N_FACES);
+
+  const size_t N_REMOVED_FACES = 10;
+  time::microseconds dIndexed = timedRun([&] {
+    for (size_t i = 0; i < N_REMOVED_FACES; ++i) {
+      fib.removeNextHopFromAllEntries(faces[i * 2]);
+    }
+  });
+  BOOST_CHECK(fib.size() == N_ENTRIES);
+
+  // removing the second nexthop erases the entries
+  time::microseconds dErase = timedRun([&] {
+    fib.removeNextHopFromAllEntries(faces[1]);
+  });
+  BOOST_CHECK(fib.size() < N_ENTRIES);
+
+  BOOST_TEST_MESSAGE("enumerate FIB for one face: " << dEnumerate);
+  BOOST_TEST_MESSAGE("removeNextHopFromAllEntries " << N_REMOVED_FACES << " faces: " << dIndexed);
+  BOOST_TEST_MESSAGE("removeNextHopFromAllEntries with erase: " << dErase);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/forwarder.hpp"
+#include "tests/daemon/fw/dummy-strategy.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class ForwarderBenchmarkFixture : public BaseFixture
+{
+protected:
+  ForwarderBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+protected:
+  static const size_t N_ENTRIES = 10000;
+  static const size_t REPEAT = 20;
+};
+
+BOOST_FIXTURE_TEST_SUITE(FwForwarderBenchmark, ForwarderBenchmarkFixture)
+
+// effective strategy lookup and trigger invocation, as done by Forwarder::dispatchToStrategy
+BOOST_AUTO_TEST_CASE(StrategyDispatch)
+{
+  Forwarder forwarder;
+  Name nameP("ndn:/strategy/P");
+  Name nameQ("ndn:/strategy/Q");
+  shared_ptr<DummyStrategy> strategyP = make_shared<DummyStrategy>(ref(forwarder), nameP);
+  shared_ptr<DummyStrategy> strategyQ = make_shared<DummyStrategy>(ref(forwarder), nameQ);
+
+  StrategyChoice& strategyChoice = forwarder.getStrategyChoice();
+  strategyChoice.install(strategyP);
+  strategyChoice.install(strategyQ);
+  strategyChoice.insert("ndn:/", nameP);
+  strategyChoice.insert("ndn:/forwarder/benchmark", nameQ);
+
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (size_t i = 0; i < N_ENTRIES; ++i) {
+    Name name("/forwarder/benchmark");
+    name.appendNumber(i % 64).appendNumber(i / 64).append("data").appendSegment(i % 8);
+    shared_ptr<Interest> interest = makeInterest(name);
+    pitEntries.push_back(forwarder.getPit().insert(*interest).first);
+  }
+
+  // before: LPM walk of the NameTree on every dispatch
+  size_t nLpm = 0;
+  time::microseconds dLpm = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<pit::Entry>& pitEntry : pitEntries) {
+        if (&strategyChoice.findEffectiveStrategy(pitEntry->getName()) == strategyQ.get())
+          ++nLpm;
+      }
+    }
+  });
+
+  // after: effective strategy cached on the NameTree entry
+  size_t nCached = 0;
+  time::microseconds dCached = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<pit::Entry>& pitEntry : pitEntries) {
+        if (&strategyChoice.findEffectiveStrategy(*pitEntry) == strategyQ.get())
+          ++nCached;
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nLpm, N_ENTRIES * REPEAT);
+  BOOST_CHECK_EQUAL(nCached, N_ENTRIES * REPEAT);
+  BOOST_TEST_MESSAGE("findEffectiveStrategy(LPM) " << (N_ENTRIES * REPEAT) << ": " << dLpm);
+  BOOST_TEST_MESSAGE("findEffectiveStrategy(cached) " << (N_ENTRIES * REPEAT) << ": " << dCached);
+
+  // before: trigger wrapped in a bind object and a std::function
+  fw::Strategy& strategy = *strategyQ;
+  time::microseconds dFunction = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<pit::Entry>& pitEntry : pitEntries) {
+        function<void(fw::Strategy*)> trigger =
+          bind(&fw::Strategy::beforeExpirePendingInterest, _1, pitEntry);
+        trigger(&strategy);
+      }
+    }
+  });
+
+  // after: direct virtual call from an inlined lambda
+  time::microseconds dDirect = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<pit::Entry>& pitEntry : pitEntries) {
+        auto trigger = [&] (fw::Strategy& s) { s.beforeExpirePendingInterest(pitEntry); };
+        trigger(strategy);
+      }
+    }
+  });
+
+  BOOST_TEST_MESSAGE("trigger(std::function) " << (N_ENTRIES * REPEAT) << ": " << dFunction);
+  BOOST_TEST_MESSAGE("trigger(direct) " << (N_ENTRIES * REPEAT) << ": " << dDirect);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/name-tree.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class NameTreeBenchmarkFixture : public BaseFixture
+{
+protected:
+  NameTreeBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief makes N_NAMES names of nComponents components,
+   *         which share their first nComponents-2 components in N_GROUPS groups
+   */
+  static std::vector<Name>
+  makeNames(size_t nComponents)
+  {
+    BOOST_ASSERT(nComponents >= 4);
+
+    std::vector<Name> names(N_NAMES);
+    for (size_t i = 0; i < N_NAMES; ++i) {
+      Name name("/name-tree/benchmark");
+      for (size_t j = 2; j < nComponents - 2; ++j) {
+        name.appendNumber((i % N_GROUPS) * 16 + j);
+      }
+      name.appendNumber(i).appendSegment(i % 4);
+      name.wireEncode();
+      names[i] = name;
+    }
+    return names;
+  }
+
+  /** \brief lookup by creating and hashing every prefix of the name,
+   *         as NameTree::lookup did before incremental prefix hashing
+   */
+  static size_t
+  lookupByPrefixCopy(const NameTree& nt, const Name& name)
+  {
+    size_t nFound = 0;
+    for (size_t i = 0; i <= name.size(); ++i) {
+      if (static_cast<bool>(nt.findExactMatch(name.getPrefix(i))))
+        ++nFound;
+    }
+    return nFound;
+  }
+
+protected:
+  static const size_t N_NAMES = 50000;
+  static const size_t N_GROUPS = 64;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableNameTreeBenchmark, NameTreeBenchmarkFixture)
+
+// lookup names of 4 to 20 components, when they are new and when they exist
+BOOST_AUTO_TEST_CASE(Lookup)
+{
+  const size_t REPEAT = 4;
+
+  for (size_t nComponents = 4; nComponents <= 20; nComponents += 4) {
+    std::vector<Name> names = makeNames(nComponents);
+    NameTree nt;
+
+    time::microseconds dInsert = timedRun([&] {
+      for (const Name& name : names) {
+        nt.lookup(name);
+      }
+    });
+
+    time::microseconds dHit = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const Name& name : names) {
+          nt.lookup(name);
+        }
+      }
+    });
+
+    size_t nFound = 0;
+    time::microseconds dPrefixCopy = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const Name& name : names) {
+          nFound += lookupByPrefixCopy(nt, name);
+        }
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nFound, N_NAMES * REPEAT * (nComponents + 1));
+    BOOST_TEST_MESSAGE("lookup(" << nComponents << " components, insert) " <<
+                       N_NAMES << ": " << dInsert);
+    BOOST_TEST_MESSAGE("lookup(" << nComponents << " components, existing) " <<
+                       (N_NAMES * REPEAT) << ": " << dHit);
+    BOOST_TEST_MESSAGE("lookup(" << nComponents << " components, prefix copy) " <<
+                       (N_NAMES * REPEAT) << ": " << dPrefixCopy);
+  }
+}
+
+// lookup names whose parent exists, as with a new segment of a known object
+BOOST_AUTO_TEST_CASE(LookupNewLeaf)
+{
+  for (size_t nComponents = 4; nComponents <= 20; nComponents += 4) {
+    std::vector<Name> names = makeNames(nComponents);
+    NameTree nt;
+    for (const Name& name : names) {
+      nt.lookup(name.getPrefix(-1));
+    }
+    size_t nBefore = nt.size();
+
+    time::microseconds d = timedRun([&] {
+      for (const Name& name : names) {
+        nt.lookup(name);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nt.size(), nBefore + N_NAMES);
+    BOOST_TEST_MESSAGE("lookup(" << nComponents << " components, new leaf) " <<
+                       N_NAMES << ": " << d);
+  }
+}
+
+// chained vs open addressing layout: insert, lookup and longest prefix match
+BOOST_AUTO_TEST_CASE(ChainedVsOpenAddressing)
+{
+  const size_t REPEAT = 4;
+  std::vector<Name> names = makeNames(8);
+
+  // names that are one component longer than existing ones
+  std::vector<Name> lpmNames;
+  for (const Name& name : names) {
+    lpmNames.push_back(Name(name).append("lpm"));
+    lpmNames.back().wireEncode();
+  }
+
+  const NameTree::HashTableLayout layouts[] = {NameTree::CHAINED_LAYOUT,
+                                               NameTree::OPEN_ADDRESSING_LAYOUT};
+  for (NameTree::HashTableLayout layout : layouts) {
+    const char* layoutName = layout == NameTree::CHAINED_LAYOUT ? "chained" : "open";
+    NameTree nt(16, layout);
+
+    // the slowest single insertion shows the stall of a full rehash
+    time::microseconds maxInsert(0);
+    time::microseconds dInsert = timedRun([&] {
+      for (const Name& name : names) {
+        time::steady_clock::TimePoint t1 = time::steady_clock::now();
+        nt.lookup(name);
+        time::steady_clock::TimePoint t2 = time::steady_clock::now();
+        maxInsert = std::max(maxInsert, time::duration_cast<time::microseconds>(t2 - t1));
+      }
+    });
+
+    time::microseconds dLookup = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const Name& name : names) {
+          nt.lookup(name);
+        }
+      }
+    });
+
+    size_t nFound = 0;
+    time::microseconds dLpm = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (const Name& name : lpmNames) {
+          if (nt.findLongestPrefixMatch(name)->getPrefix().size() + 1 == name.size())
+            ++nFound;
+        }
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nFound, N_NAMES * REPEAT);
+    BOOST_TEST_MESSAGE("insert(" << layoutName << ") " << N_NAMES << ": " << dInsert <<
+                       ", slowest " << maxInsert);
+    BOOST_TEST_MESSAGE("lookup(" << layoutName << ") " << (N_NAMES * REPEAT) << ": " << dLookup);
+    BOOST_TEST_MESSAGE("lpm(" << layoutName << ") " << (N_NAMES * REPEAT) << ": " << dLpm);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
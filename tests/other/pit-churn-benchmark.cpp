@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class PitChurnBenchmarkFixture : public BaseFixture
+{
+protected:
+  PitChurnBenchmarkFixture()
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+
+    for (size_t i = 0; i < N_FACES; ++i) {
+      faces.push_back(make_shared<DummyFace>());
+    }
+
+    for (size_t i = 0; i < N_INTERESTS; ++i) {
+      Name name("/pit/churn/benchmark");
+      name.appendNumber(i / 4).appendSegment(i % 4);
+      interests.push_back(makeInterest(name));
+      interests.back()->setNonce(static_cast<uint32_t>(i));
+    }
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief inserts every Interest into pit with one to three downstreams and one or two
+   *         upstreams, checks nonces as the forwarding pipelines do, then erases the entries
+   *  \return number of duplicate nonces found, which is always zero
+   */
+  size_t
+  churn(Pit& pit)
+  {
+    size_t nDuplicates = 0;
+    std::vector<shared_ptr<pit::Entry>> entries;
+    entries.reserve(interests.size());
+
+    for (size_t i = 0; i < interests.size(); ++i) {
+      const Interest& interest = *interests[i];
+      shared_ptr<pit::Entry> entry = pit.insert(interest).first;
+
+      size_t nDownstreams = 1 + i % 3;
+      for (size_t j = 0; j < nDownstreams; ++j) {
+        const shared_ptr<Face>& face = faces[(i + j) % N_FACES];
+        if (entry->findNonce(interest.getNonce() + 1, *face) != pit::DUPLICATE_NONCE_NONE)
+          ++nDuplicates;
+        entry->insertOrUpdateInRecord(face, interest);
+      }
+
+      size_t nUpstreams = 1 + i % 2;
+      for (size_t j = 0; j < nUpstreams; ++j) {
+        const shared_ptr<Face>& face = faces[(i + N_FACES / 2 + j) % N_FACES];
+        if (entry->getOutRecord(*face) != entry->getOutRecords().end())
+          ++nDuplicates;
+        entry->insertOrUpdateOutRecord(face, interest);
+      }
+
+      entries.push_back(entry);
+    }
+
+    for (const shared_ptr<pit::Entry>& entry : entries) {
+      entry->deleteInRecords();
+      pit.erase(entry);
+    }
+    return nDuplicates;
+  }
+
+protected:
+  static const size_t N_FACES = 16;
+  static const size_t N_INTERESTS = 20000;
+  static const size_t N_ROUNDS = 8;
+
+  std::vector<shared_ptr<Face>> faces;
+  std::vector<shared_ptr<Interest>> interests;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TablePitChurnBenchmark, PitChurnBenchmarkFixture)
+
+// insert, forward and satisfy Interests repeatedly, with and without an EntryPool
+BOOST_AUTO_TEST_CASE(Churn)
+{
+  pit::EntryPool pool;
+  const pit::EntryPool* pools[] = {nullptr, &pool};
+
+  for (const pit::EntryPool* entryPool : pools) {
+    NameTree nameTree;
+    Pit pit(nameTree, entryPool);
+
+    size_t nDuplicates = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t round = 0; round < N_ROUNDS; ++round) {
+        nDuplicates += churn(pit);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nDuplicates, 0);
+    BOOST_CHECK_EQUAL(pit.size(), 0);
+    BOOST_TEST_MESSAGE("churn(" << (entryPool == nullptr ? "make_shared" : "pool") << ") " <<
+                       (N_INTERESTS * N_ROUNDS) << ": " << d);
+  }
+
+  BOOST_TEST_MESSAGE("pool peak " << pool.getEntryPool().getNPeakInUse() <<
+                     " capacity " << pool.getEntryPool().getCapacity() <<
+                     " reused " << pool.getEntryPool().getNReused());
+}
+
+// record lookup in the inline collection, compared with the former std::list collection
+BOOST_AUTO_TEST_CASE(RecordLookup)
+{
+  const size_t REPEAT = 200000;
+  const Interest& interest = *interests.front();
+
+  for (size_t nRecords = 1; nRecords <= 4; ++nRecords) {
+    pit::InRecordCollection smallVector;
+    std::list<pit::InRecord> list;
+    for (size_t i = 0; i < nRecords; ++i) {
+      smallVector.emplace_back(faces[i]);
+      smallVector.back().update(interest);
+      list.emplace_front(faces[i]);
+      list.front().update(interest);
+    }
+
+    const Face& last = *faces[nRecords - 1];
+    auto isLast = [&last] (const pit::InRecord& inRecord) {
+      return inRecord.getFace().get() == &last;
+    };
+
+    size_t nFound = 0;
+    time::microseconds dInline = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        if (std::find_if(smallVector.begin(), smallVector.end(), isLast) != smallVector.end())
+          ++nFound;
+      }
+    });
+    time::microseconds dList = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        if (std::find_if(list.begin(), list.end(), isLast) != list.end())
+          ++nFound;
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nFound, 2 * REPEAT);
+    BOOST_TEST_MESSAGE("getInRecord(" << nRecords << " records, inline) " << REPEAT << ": " <<
+                       dInline);
+    BOOST_TEST_MESSAGE("getInRecord(" << nRecords << " records, list) " << REPEAT << ": " <<
+                       dList);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
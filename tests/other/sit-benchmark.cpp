@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/sit.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd {
+namespace tests {
+
+class SitBenchmarkFixture : public BaseFixture
+{
+protected:
+  SitBenchmarkFixture()
+    : sit(nameTree)
+    , pit(nameTree)
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+  }
+
+  time::microseconds
+  timedRun(std::function<void()> f)
+  {
+    time::steady_clock::TimePoint t1 = time::steady_clock::now();
+    f();
+    time::steady_clock::TimePoint t2 = time::steady_clock::now();
+    return time::duration_cast<time::microseconds>(t2 - t1);
+  }
+
+  /** \brief Data match by enumerating NameTree ancestors and calling Interest::matchesData,
+   *         as Sit::findAllDataMatches did before the subscription index
+   */
+  size_t
+  findAllDataMatchesByScan(const Data& data) const
+  {
+    auto&& ntMatches = nameTree.findAllMatches(data.getName(),
+      [] (const name_tree::Entry& entry) { return entry.hasSitEntries(); });
+
+    size_t nMatches = 0;
+    for (const name_tree::Entry& nte : ntMatches) {
+      for (const shared_ptr<pit::SitEntry>& sitEntry : nte.getSitEntries()) {
+        if (sitEntry->getInterest().matchesData(data))
+          ++nMatches;
+      }
+    }
+    return nMatches;
+  }
+
+  /** \brief subscribes to N_TOPICS topics, and fills NameTree with pending Interests
+   *         in the same namespace that a NameTree walk has to step over
+   */
+  void
+  populate()
+  {
+    for (size_t i = 0; i < N_TOPICS; ++i) {
+      Name topic("/sit/benchmark");
+      topic.appendNumber(i % N_GROUPS).appendNumber(i);
+      sit.insert(*makeInterest(topic));
+
+      // a second subscription on the same topic that wants only deep Data
+      if (i % 8 == 0) {
+        shared_ptr<Interest> deep = makeInterest(topic);
+        deep->setMinSuffixComponents(3);
+        sit.insert(*deep);
+      }
+
+      Name pending(topic);
+      pending.appendNumber(0).appendNumber(0);
+      pit.insert(*makeInterest(pending));
+    }
+  }
+
+  std::vector<shared_ptr<Data>>
+  makeDataWorkload(size_t count)
+  {
+    std::vector<shared_ptr<Data>> workload(count);
+    for (size_t i = 0; i < count; ++i) {
+      Name name("/sit/benchmark");
+      name.appendNumber(i % N_GROUPS).appendNumber(i % N_TOPICS).appendSegment(i);
+      workload[i] = makeData(name);
+    }
+    return workload;
+  }
+
+protected:
+  NameTree nameTree;
+  Sit sit;
+  Pit pit;
+  static const size_t N_TOPICS = 20000;
+  static const size_t N_GROUPS = 16;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TableSitBenchmark, SitBenchmarkFixture)
+
+// publish Data under subscribed topics: NameTree scan vs subscription index
+BOOST_AUTO_TEST_CASE(PublishScanVsIndex)
+{
+  this->populate();
+
+  const size_t N_WORKLOAD = N_TOPICS * 2;
+  const size_t REPEAT = 4;
+  std::vector<shared_ptr<Data>> dataWorkload = makeDataWorkload(N_WORKLOAD);
+
+  size_t nScanMatches = 0;
+  time::microseconds dScan = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<Data>& data : dataWorkload) {
+        nScanMatches += this->findAllDataMatchesByScan(*data);
+      }
+    }
+  });
+
+  size_t nIndexMatches = 0;
+  time::microseconds dIndex = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<Data>& data : dataWorkload) {
+        nIndexMatches += sit.findAllDataMatches(*data).size();
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nScanMatches, nIndexMatches);
+  BOOST_TEST_MESSAGE("publish(scan) " << (N_WORKLOAD * REPEAT) << ": " << dScan);
+  BOOST_TEST_MESSAGE("publish(index) " << (N_WORKLOAD * REPEAT) << ": " << dIndex);
+}
+
+// PIT and SIT match: separate walks vs combined walk
+BOOST_AUTO_TEST_CASE(PitAndSitSeparateVsCombined)
+{
+  this->populate();
+
+  const size_t N_WORKLOAD = N_TOPICS * 2;
+  const size_t REPEAT = 4;
+  std::vector<shared_ptr<Data>> dataWorkload = makeDataWorkload(N_WORKLOAD);
+
+  size_t nSeparateMatches = 0;
+  time::microseconds dSeparate = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<Data>& data : dataWorkload) {
+        nSeparateMatches += pit.findAllDataMatches(*data).size();
+        nSeparateMatches += sit.findAllDataMatches(*data).size();
+      }
+    }
+  });
+
+  size_t nCombinedMatches = 0;
+  time::microseconds dCombined = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<Data>& data : dataWorkload) {
+        pit::CombinedDataMatchResult result = sit.findAllPitAndSitMatches(*data);
+        nCombinedMatches += result.pitMatches.size() + result.sitMatches.size();
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nSeparateMatches, nCombinedMatches);
+  BOOST_TEST_MESSAGE("pit+sit(separate) " << (N_WORKLOAD * REPEAT) << ": " << dSeparate);
+  BOOST_TEST_MESSAGE("pit+sit(combined) " << (N_WORKLOAD * REPEAT) << ": " << dCombined);
+}
+
+// publish Data that no one subscribes to
+BOOST_AUTO_TEST_CASE(PublishUnsubscribed)
+{
+  this->populate();
+
+  const size_t N_WORKLOAD = N_TOPICS * 2;
+  const size_t REPEAT = 4;
+  std::vector<shared_ptr<Data>> dataWorkload(N_WORKLOAD);
+  for (size_t i = 0; i < N_WORKLOAD; ++i) {
+    Name name("/sit/benchmark");
+    name.appendNumber(i % N_GROUPS).appendNumber(N_TOPICS + i).appendSegment(i);
+    dataWorkload[i] = makeData(name);
+  }
+
+  size_t nScanMatches = 0;
+  time::microseconds dScan = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<Data>& data : dataWorkload) {
+        nScanMatches += this->findAllDataMatchesByScan(*data);
+      }
+    }
+  });
+
+  size_t nIndexMatches = 0;
+  time::microseconds dIndex = timedRun([&] {
+    for (size_t j = 0; j < REPEAT; ++j) {
+      for (const shared_ptr<Data>& data : dataWorkload) {
+        nIndexMatches += sit.findAllDataMatches(*data).size();
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nScanMatches, 0);
+  BOOST_CHECK_EQUAL(nIndexMatches, 0);
+  BOOST_TEST_MESSAGE("publish-unsubscribed(scan) " << (N_WORKLOAD * REPEAT) << ": " << dScan);
+  BOOST_TEST_MESSAGE("publish-unsubscribed(index) " << (N_WORKLOAD * REPEAT) << ": " << dIndex);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd
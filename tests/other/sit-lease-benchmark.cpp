@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2015,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/sit.hpp"
+#include "table/pit-entry-pool.hpp"
+#include "core/random.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/random/uniform_int_distribution.hpp>
+#include <algorithm>
+
+namespace nfd {
+namespace tests {
+
+/** \brief a churning subscriber population
+ *
+ *  Subscribers arrive at a fixed rate, refresh their subscription every REFRESH_INTERVAL
+ *  for a random duration, then leave without unsubscribing.
+ *  The sweep is driven at Forwarder's rate, visiting a quarter of the SIT per SWEEP_INTERVAL;
+ *  sweeps that fall due within a TICK run at the end of that TICK.
+ */
+class SitLeaseBenchmarkFixture : public UnitTestTimeFixture
+{
+protected:
+  SitLeaseBenchmarkFixture()
+    : sit(nameTree, &pool)
+  {
+#ifdef _DEBUG
+    BOOST_TEST_MESSAGE("Benchmark compiled in debug mode is unreliable, "
+                       "please compile in release mode.");
+#endif // _DEBUG
+
+    for (size_t i = 0; i < N_FACES; ++i) {
+      faces.push_back(make_shared<DummyFace>());
+    }
+  }
+
+  struct Subscriber
+  {
+    shared_ptr<Interest> interest;
+    shared_ptr<Face> face;
+    time::steady_clock::TimePoint leaveTime;
+    time::steady_clock::TimePoint nextRefresh;
+  };
+
+  void
+  subscribe(Subscriber& subscriber)
+  {
+    shared_ptr<pit::SitEntry> entry = sit.insert(*subscriber.interest).first;
+    entry->pit::Entry::insertOrUpdateInRecord(subscriber.face, *subscriber.interest);
+    subscriber.nextRefresh = time::steady_clock::now() + REFRESH_INTERVAL;
+  }
+
+protected:
+  static const size_t N_FACES = 100;
+  static const size_t N_TOPICS = 20000;
+  static const size_t ARRIVALS_PER_TICK = 50;
+  static const size_t MAX_STAY_TICKS = 300;
+
+  static const time::milliseconds TICK;
+  static const time::milliseconds REFRESH_INTERVAL;
+  static const time::milliseconds LEASE;
+  static const time::milliseconds SWEEP_INTERVAL;
+
+  NameTree nameTree;
+  pit::EntryPool pool;
+  Sit sit;
+  std::vector<shared_ptr<Face>> faces;
+};
+
+const time::milliseconds SitLeaseBenchmarkFixture::TICK = time::milliseconds(100);
+const time::milliseconds SitLeaseBenchmarkFixture::REFRESH_INTERVAL = time::seconds(1);
+const time::milliseconds SitLeaseBenchmarkFixture::LEASE = time::seconds(2);
+const time::milliseconds SitLeaseBenchmarkFixture::SWEEP_INTERVAL = time::milliseconds(250);
+
+BOOST_FIXTURE_TEST_SUITE(TableSitLeaseBenchmark, SitLeaseBenchmarkFixture)
+
+BOOST_AUTO_TEST_CASE(Churn)
+{
+  boost::random::uniform_int_distribution<size_t> topicDist(0, N_TOPICS - 1);
+  boost::random::uniform_int_distribution<size_t> faceDist(0, N_FACES - 1);
+  boost::random::uniform_int_distribution<size_t> stayDist(1, MAX_STAY_TICKS);
+
+  std::vector<Subscriber> subscribers;
+  size_t nInserted = 0;
+  size_t nErased = 0;
+  time::milliseconds sinceSweep = time::milliseconds::zero();
+
+  const size_t N_TICKS = 1200;
+  for (size_t tick = 1; tick <= N_TICKS; ++tick) {
+    time::steady_clock::TimePoint now = time::steady_clock::now();
+
+    for (size_t i = 0; i < ARRIVALS_PER_TICK; ++i) {
+      Name name("/topic");
+      name.appendNumber(topicDist(getGlobalRng()));
+      Subscriber subscriber;
+      subscriber.interest = makeInterest(name);
+      subscriber.interest->setInterestLifetime(LEASE);
+      subscriber.face = faces[faceDist(getGlobalRng())];
+      subscriber.leaveTime = now + TICK * stayDist(getGlobalRng());
+      size_t sizeBefore = sit.size();
+      this->subscribe(subscriber);
+      nInserted += sit.size() - sizeBefore;
+      subscribers.push_back(subscriber);
+    }
+
+    // subscribers that stay refresh, the others leave silently
+    auto last = std::remove_if(subscribers.begin(), subscribers.end(),
+      [now] (const Subscriber& subscriber) { return subscriber.leaveTime <= now; });
+    subscribers.erase(last, subscribers.end());
+    for (Subscriber& subscriber : subscribers) {
+      if (subscriber.nextRefresh <= now) {
+        this->subscribe(subscriber);
+      }
+    }
+
+    sinceSweep += TICK;
+    while (sinceSweep >= SWEEP_INTERVAL) {
+      sinceSweep -= SWEEP_INTERVAL;
+      nErased += sit.sweep(std::max<size_t>(64, sit.size() / 4));
+    }
+
+    if (tick % 100 == 0) {
+      BOOST_TEST_MESSAGE("t=" << (TICK * tick) <<
+                         " subscribers=" << subscribers.size() <<
+                         " sit=" << sit.size() <<
+                         " nameTree=" << nameTree.size() <<
+                         " sitPoolInUse=" << pool.getSitEntryPool().getNInUse() <<
+                         " sitPoolPeak=" << pool.getSitEntryPool().getNPeakInUse() <<
+                         " withoutSweep=" << nInserted);
+    }
+
+    this->advanceClocks(TICK);
+  }
+
+  BOOST_CHECK_EQUAL(sit.size(), nInserted - nErased);
+  BOOST_CHECK_LT(sit.size(), nInserted);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace tests
+} // namespace nfd